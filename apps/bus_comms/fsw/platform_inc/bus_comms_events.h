@@ -14,4 +14,20 @@
 
 #define BUS_COMMS_INVALID_TASKID        8
 
+#define BUS_COMMS_INGEST_ALLOC_ERR_EID  9
+#define BUS_COMMS_INGEST_SEND_ERR_EID   10
+#define BUS_COMMS_ROUTE_FILE_INF_EID    11
+#define BUS_COMMS_ROUTE_FILE_ERR_EID    12
+#define BUS_COMMS_BATCH_INF_EID         13
+#define BUS_COMMS_TBL_VALIDATION_ERR_EID 14
+#define BUS_COMMS_TBL_UPDATE_INF_EID    15
+#define BUS_COMMS_XFER_INF_EID          16
+#define BUS_COMMS_XFER_ERR_EID          17
+#define BUS_COMMS_BENCH_INF_EID         18
+#define BUS_COMMS_NODE_DOWN_ERR_EID     19
+#define BUS_COMMS_NODE_UP_INF_EID       20
+#define BUS_COMMS_SEND_ERR_EID          21
+#define BUS_COMMS_IF_FAILOVER_INF_EID   22
+#define BUS_COMMS_CONN_ERR_EID          23
+
 #endif /* BUS_COMMS_EVENTS_H */
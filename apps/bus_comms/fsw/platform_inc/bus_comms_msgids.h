@@ -4,8 +4,12 @@
 #ifndef BUS_COMMS_MSGIDS_H
 #define BUS_COMMS_MSGIDS_H
 
-#define BUS_COMMS_CMD_MID     0x1888
-#define BUS_COMMS_SEND_HK_MID 0x1889
-#define BUS_COMMS_HK_TLM_MID  0x0889
+#define BUS_COMMS_CMD_MID       0x1888
+#define BUS_COMMS_SEND_HK_MID   0x1889
+#define BUS_COMMS_HK_TLM_MID    0x0889
+#define BUS_COMMS_ROUTE_TLM_MID 0x088A
+#define BUS_COMMS_BATCH_TLM_MID 0x088B
+#define BUS_COMMS_BENCH_TLM_MID 0x088C
+#define BUS_COMMS_SEND_STATUS_TLM_MID 0x088D
 
 #endif /* BUS_COMMS_MSGIDS_H */
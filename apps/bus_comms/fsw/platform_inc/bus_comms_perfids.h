@@ -4,6 +4,21 @@
 #ifndef BUS_COMMS_PERFIDS_H
 #define BUS_COMMS_PERFIDS_H
 
-#define BUS_COMMS_APP_PERF_ID 192
+#define BUS_COMMS_APP_PERF_ID          192
+
+/* Router task work between csp_route_work() passes, excluding libcsp's wait */
+#define BUS_COMMS_ROUTER_PERF_ID       193
+
+/* Handling of one accepted connection or one burst of datagrams */
+#define BUS_COMMS_RX_PERF_ID           194
+
+/* One TX service pass over the packets collected from the queue */
+#define BUS_COMMS_TX_PERF_ID           195
+
+/* csp_connect() on a connection cache miss */
+#define BUS_COMMS_CONNECT_PERF_ID      196
+
+/* Routing table update for received or sent traffic */
+#define BUS_COMMS_ROUTE_UPDATE_PERF_ID 197
 
 #endif /* BUS_COMMS_PERFIDS_H */
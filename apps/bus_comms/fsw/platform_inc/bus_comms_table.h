@@ -1,5 +1,5 @@
 /************************************************************************
- * Bus Communications App - routing table definitions (minimal stub)
+ * Bus Communications App - configuration table definitions
  ************************************************************************/
 #ifndef BUS_COMMS_TABLE_H
 #define BUS_COMMS_TABLE_H
@@ -7,24 +7,175 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "cfe_sb.h"
+
+#define BUS_COMMS_MAX_SOURCE_MAPPINGS 16
+#define BUS_COMMS_MAX_INGEST_MAPPINGS 16
+#define BUS_COMMS_MAX_NODE_MAPPINGS   8
+#define BUS_COMMS_MAX_RATE_LIMITS     16
+#define BUS_COMMS_MAX_SCHEDULES       8
+#define BUS_COMMS_MAX_INTERFACES      4
+#define BUS_COMMS_MAX_IF_ROUTES       16
+
+#define BUS_COMMS_IF_DEVICE_LEN       32
+#define BUS_COMMS_SCHED_MAX_DATA      32
+#define BUS_COMMS_SCHED_MIN_PERIOD    100 /* msec */
+
+/* Destination placeholder resolved to the paired node picked at startup */
+#define BUS_COMMS_ADDR_PEER 0xFF
+
+/*
+ * Interface types.  CAN opens a SocketCAN device, ZMQ connects to a ZMQ
+ * hub (libcsp's zmqproxy) and stands in for the bus on a development host.
+ * LOOPBACK opens nothing: a node whose only interfaces are LOOPBACK talks
+ * to itself through the CSP loopback interface, and its peer address is
+ * forced to its own.  Used by the simulation/benchmark build.
+ */
+#define BUS_COMMS_IF_TYPE_CAN      0
+#define BUS_COMMS_IF_TYPE_ZMQ      1
+#define BUS_COMMS_IF_TYPE_LOOPBACK 2
+
+/* Backup value for a route with no second interface */
+#define BUS_COMMS_IF_NONE 0xFF
+
+/*
+ * Per-port transport mode.  CONN opens a CSP connection (cached on the TX
+ * side) and suits command ports; DGRAM uses connection-less sends and a
+ * CSP_SO_CONN_LESS socket on receive, for bulk telemetry.
+ */
+#define BUS_COMMS_PORT_MODE_CONN  0
+#define BUS_COMMS_PORT_MODE_DGRAM 1
+
 /*
- * Minimal device entry and table definition to satisfy includes.
- * Expand as needed when you add real routing entries.
+ * One CSP interface.  Exactly one CAN or ZMQ entry is the default and
+ * carries traffic for destinations without an InterfaceRoutes entry.
  */
 typedef struct
 {
-    uint8_t device_id;   /* Device identifier */
-    uint8_t port;        /* Logical port on the bus/radio */
-    bool    active;      /* Whether this route is active */
-} BUS_COMMS_DeviceEntry_t;
+    uint8_t Type;      /* BUS_COMMS_IF_TYPE_* */
+    bool    IsDefault;
+    bool    InUse;
+    char    Device[BUS_COMMS_IF_DEVICE_LEN]; /* SocketCAN device, or ZMQ hub host */
+    uint32  Bitrate;   /* CAN only */
+} BUS_COMMS_InterfaceEntry_t;
 
+/*
+ * Interface selection for one destination, by index into Interfaces.
+ * When heartbeats to the node go unanswered the route moves to Backup,
+ * and keeps alternating between the two until the node answers.
+ */
+typedef struct
+{
+    uint8_t dest;      /* CSP address, or BUS_COMMS_ADDR_PEER */
+    uint8_t Primary;
+    uint8_t Backup;    /* or BUS_COMMS_IF_NONE */
+    bool    InUse;
+} BUS_COMMS_IfRouteEntry_t;
+
+/*
+ * CSP addresses of this node and its paired peer when running on
+ * ProcessorId; processors without an entry use DefaultNode.
+ */
 typedef struct
 {
-    BUS_COMMS_DeviceEntry_t entries[16];
+    uint32  ProcessorId;
+    uint8_t MyAddr;
+    uint8_t PeerAddr;
+    bool    InUse;
+} BUS_COMMS_NodeMapEntry_t;
+
+/* Token bucket limit for traffic to one CSP address */
+typedef struct
+{
+    uint8_t dest;          /* CSP address, or BUS_COMMS_ADDR_PEER */
+    bool    InUse;
+    uint32  BytesPerSec;   /* 0 = unlimited */
+    uint32  Burst;         /* bytes */
+} BUS_COMMS_RateLimitEntry_t;
+
+/* Fixed payload sent to dest:port every PeriodMsec (e.g. the link ping) */
+typedef struct
+{
+    uint32  PeriodMsec;
+    uint8_t dest;          /* CSP address, or BUS_COMMS_ADDR_PEER */
+    uint8_t port;
+    uint8_t prio;          /* CSP priority (CSP_PRIO_*) */
+    uint8_t len;
+    uint8_t data[BUS_COMMS_SCHED_MAX_DATA];
+    bool    InUse;
+} BUS_COMMS_ScheduleEntry_t;
+
+/*
+ * SB-to-CSP bridge entry: every message published on SourceMsgId is
+ * forwarded as-is (headers included) to dest:port on the CAN bus.
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t SourceMsgId;
+    uint8_t        dest;   /* CSP address, or BUS_COMMS_ADDR_PEER */
+    uint8_t        port;   /* CSP destination port */
+    uint8_t        prio;   /* CSP priority (CSP_PRIO_*) */
+    uint8_t        mode;   /* BUS_COMMS_PORT_MODE_* */
+    bool           segmented; /* send as fragments; required above one CSP buffer */
+    bool           InUse;
+} BUS_COMMS_SourcePipeMapEntry_t;
+
+/*
+ * CSP-to-SB ingest entry: packets arriving on 'port' are published on the
+ * software bus.  With a valid MsgId the payload is wrapped in a telemetry
+ * header carrying that MID; with CFE_SB_INVALID_MSG_ID the payload must
+ * already be a complete SB message (e.g. from the peer's bridge) and is
+ * published unchanged.
+ */
+typedef struct
+{
+    uint8_t        port;
+    uint8_t        mode;      /* BUS_COMMS_PORT_MODE_* */
+    bool           segmented; /* packets are fragments to reassemble; must match the sender */
+    CFE_SB_MsgId_t MsgId;
+    bool           InUse;
+} BUS_COMMS_IngestMapEntry_t;
+
+/*
+ * The whole table is validated on every load.  Rate limits, schedules,
+ * TxQueueDepth, CmdBudgetMsec and CspBufferCount take effect as soon as a new load is
+ * activated; the interfaces and their routes, node addresses, ports, heartbeat settings,
+ * bridge/ingest maps and pipe depth are read once at startup and need an
+ * app restart.
+ */
+typedef struct
+{
+    uint8_t  CspPort;        /* port the receiver listens on; pings and NOOP demo sends */
+    uint8_t  XferPort;       /* file transfer port, 0 disables the service */
+    uint16   BridgePipeDepth;
+    uint16   TxQueueDepth;   /* per priority lane, at most BUS_COMMS_TXQ_LANE_DEPTH */
+    uint8_t  BenchPort;      /* benchmark echo port, 0 disables the service */
+    uint8_t  HbPort;         /* heartbeat port, 0 disables heartbeats */
+    uint16   HbPeriodMsec;
+    uint16   HbMissLimit;    /* unanswered heartbeats before a node counts as dead */
+    uint16   CmdBudgetMsec;  /* time a commanded send may spend queued and connecting, 0 = no limit */
+    uint16   CspBufferCount; /* CSP buffers in use beyond which bus_comms allocations fail, 0 = whole pool */
+
+    BUS_COMMS_InterfaceEntry_t     Interfaces[BUS_COMMS_MAX_INTERFACES];
+    BUS_COMMS_IfRouteEntry_t       InterfaceRoutes[BUS_COMMS_MAX_IF_ROUTES];
+
+    BUS_COMMS_NodeMapEntry_t       DefaultNode;
+    BUS_COMMS_NodeMapEntry_t       NodeMap[BUS_COMMS_MAX_NODE_MAPPINGS];
+
+    uint32                         DefaultBytesPerSec;
+    uint32                         DefaultBurst;
+    BUS_COMMS_RateLimitEntry_t     RateLimits[BUS_COMMS_MAX_RATE_LIMITS];
+
+    BUS_COMMS_ScheduleEntry_t      Schedules[BUS_COMMS_MAX_SCHEDULES];
+
+    BUS_COMMS_SourcePipeMapEntry_t SourceMap[BUS_COMMS_MAX_SOURCE_MAPPINGS];
+    BUS_COMMS_IngestMapEntry_t     IngestMap[BUS_COMMS_MAX_INGEST_MAPPINGS];
 } BUS_COMMS_Table_t;
 
-/* Optional table constants (not required unless you register tables) */
-#define BUS_COMMS_NUMBER_OF_TABLES 0
+#define BUS_COMMS_NUMBER_OF_TABLES 1
+#define BUS_COMMS_TABLE_NAME       "BusCommsTable"
 #define BUS_COMMS_TABLE_FILE       "/cf/bus_comms_tbl.tbl"
 
+#define BUS_COMMS_TABLE_OUT_OF_RANGE_ERR_CODE -1
+
 #endif /* BUS_COMMS_TABLE_H */
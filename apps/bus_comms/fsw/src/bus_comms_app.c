@@ -6,6 +6,19 @@
 #include "bus_comms_events.h"
 #include "bus_comms_version.h"
 #include "bus_comms_table.h"
+#include "bus_comms_conn.h"
+#include "bus_comms_bridge.h"
+#include "bus_comms_route.h"
+#include "bus_comms_txq.h"
+#include "bus_comms_sched.h"
+#include "bus_comms_config.h"
+#include "bus_comms_frag.h"
+#include "bus_comms_xfer.h"
+#include "bus_comms_bench.h"
+#include "bus_comms_hb.h"
+#include "bus_comms_iface.h"
+#include "bus_comms_buf.h"
+#include "bus_comms_event.h"
 
 #include <string.h>
 #include <stdint.h>
@@ -13,69 +26,42 @@
 
 // Add libcsp headers
 #include <csp/csp.h>
-#include <csp/csp_debug.h>
-#include <csp/interfaces/csp_if_can.h>
-#include <csp/drivers/can_socketcan.h>
 
 // Add cFE time for timestamps in routing table
 #include "cfe_time.h"
 #include "cfe_psp.h"
 #include "osapi.h"
 
-extern int32 OS_Milli2Ticks(uint32 milli_seconds, int *ticks);
+// Bridge task wakes this often even with no traffic
+#define BUS_COMMS_BRIDGE_PEND_MSEC     BUS_COMMS_STOP_POLL_MSEC
 
-// CSP configuration (adjust as needed)
-#define BUS_COMMS_CSP_CAN_IF     "can0"
-#define BUS_COMMS_CSP_BITRATE    1000000
-#define BUS_COMMS_CSP_MY_ADDR    1
-#define BUS_COMMS_CSP_DEST_ADDR  2
-#define BUS_COMMS_CSP_PORT       10
+// Shutdown gives the child tasks this long to leave before ES deletes them
+#define BUS_COMMS_STOP_WAIT_MSEC       2000
 
 // Child task IDs
 static CFE_ES_TaskId_t BUS_COMMS_CSP_RouterTaskId   = CFE_ES_TASKID_UNDEFINED;
 static CFE_ES_TaskId_t BUS_COMMS_CSP_ReceiverTaskId = CFE_ES_TASKID_UNDEFINED;
 static CFE_ES_TaskId_t BUS_COMMS_CSP_TxTaskId       = CFE_ES_TASKID_UNDEFINED;
+static CFE_ES_TaskId_t BUS_COMMS_CSP_DgramTaskId    = CFE_ES_TASKID_UNDEFINED;
+static CFE_ES_TaskId_t BUS_COMMS_CSP_BridgeTaskId   = CFE_ES_TASKID_UNDEFINED;
+static CFE_ES_TaskId_t BUS_COMMS_CSP_XferTaskId     = CFE_ES_TASKID_UNDEFINED;
+static CFE_ES_TaskId_t BUS_COMMS_CSP_BenchTaskId    = CFE_ES_TASKID_UNDEFINED;
 
-// New command codes (define locally if not provided by headers)
-#ifndef BUS_COMMS_SEND_CSP_CC
-#define BUS_COMMS_SEND_CSP_CC        0x10
-#endif
-#ifndef BUS_COMMS_LIST_ROUTES_CC
-#define BUS_COMMS_LIST_ROUTES_CC     0x11
-#endif
+static const CFE_ES_TaskId_t *const g_child_task_ids[] = {
+    &BUS_COMMS_CSP_RouterTaskId, &BUS_COMMS_CSP_ReceiverTaskId, &BUS_COMMS_CSP_TxTaskId,
+    &BUS_COMMS_CSP_DgramTaskId,  &BUS_COMMS_CSP_BridgeTaskId,   &BUS_COMMS_CSP_XferTaskId,
+    &BUS_COMMS_CSP_BenchTaskId};
 
-// Limits for routing and payloads
-#define BUS_COMMS_MAX_ROUTES          16
-#define BUS_COMMS_MAX_SEND_LEN        220
-#define BUS_COMMS_MAX_SOURCE_MAPPINGS 16
+// Cleared once by the main task at shutdown and only read by the children;
+// each child gives the exit semaphore once on its way out
+static volatile bool g_children_run = true;
+static osal_id_t     g_child_exit_sem;
 
-// New routing table entry
-typedef struct {
-    uint8_t addr;
-    uint16_t last_port;
-    uint32_t rx_count;
-    uint32_t tx_count;
-    CFE_TIME_SysTime_t last_seen;
-} bus_comms_route_entry_t;
-
-// Routing table (module-local)
-static bus_comms_route_entry_t g_routes[BUS_COMMS_MAX_ROUTES] = {0};
-static uint8_t g_route_count = 0;
-
-// Placeholder mapping between message sources and SBN pipes
-typedef struct
-{
-    CFE_SB_MsgId_t SourceMsgId;
-    uint16         SbnPublisherPipeId;
-    uint16         SbnSubscriberPipeId;
-    bool           InUse;
-} BUS_COMMS_SourcePipeMapEntry_t;
+// Router backs off this long if libcsp reports anything but a timeout
+#define BUS_COMMS_ROUTER_ERR_DELAY_MSEC 10
 
-static BUS_COMMS_SourcePipeMapEntry_t g_source_pipe_map[BUS_COMMS_MAX_SOURCE_MAPPINGS] = {0};
-static bool g_missing_sbn_map_logged = false;
-
-static const BUS_COMMS_SourcePipeMapEntry_t * BUS_COMMS_SourceToSbnMap(CFE_SB_MsgId_t msg_id);
-static void BUS_COMMS_SourcePipeMapInit(void);
+// Limits for payloads
+#define BUS_COMMS_MAX_SEND_LEN        220
 
 // Generic SEND_CSP command payload layout
 typedef struct {
@@ -87,18 +73,22 @@ typedef struct {
 } BUS_COMMS_SendCspCmd_t;
 
 // Forward declarations for new helpers
-static void BUS_COMMS_RouteUpdateRx(uint8_t addr, uint16_t port);
-static void BUS_COMMS_RouteUpdateTx(uint8_t addr, uint16_t port);
-static int  BUS_COMMS_CSP_Send(uint8_t dest, uint8_t port, const void * data, uint16_t len);
+static int  BUS_COMMS_CSP_Send(uint8_t prio, uint8_t dest, uint8_t port, const void * data, uint16_t len,
+                               bool report, uint16 tag);
 static void BUS_COMMS_CSP_TxTask(void);
 static void BUS_COMMS_SelectNodeIds(void);
+static void BUS_COMMS_SendCspBatchCmd(const CFE_SB_Buffer_t *SBBufPtr);
+static void BUS_COMMS_Shutdown(void);
 
 // Forward declarations
 static void BUS_COMMS_CSP_RouterTask(void);
 static void BUS_COMMS_CSP_ReceiverTask(void);
+static void BUS_COMMS_CSP_DgramReceiverTask(void);
+static void BUS_COMMS_CSP_BridgeTask(void);
 
-static uint8_t g_csp_my_addr   = BUS_COMMS_CSP_MY_ADDR;
-static uint8_t g_csp_dest_addr = BUS_COMMS_CSP_DEST_ADDR;
+// Resolved from the table's node map at startup
+static uint8_t g_csp_my_addr;
+static uint8_t g_csp_dest_addr;
 
 BUS_COMMS_AppData_t BUS_COMMS_AppData;
 
@@ -144,9 +134,71 @@ void BUS_COMMS_AppMain(void)
     }
 
     CFE_ES_PerfLogExit(BUS_COMMS_APP_PERF_ID);
+
+    // Restart and reload come through here too, so leave nothing running behind the module
+    BUS_COMMS_Shutdown();
+
     CFE_ES_ExitApp(BUS_COMMS_AppData.RunStatus);
 }
 
+bool BUS_COMMS_Running(void)
+{
+    return g_children_run;
+}
+
+void BUS_COMMS_ChildExit(void)
+{
+    OS_CountSemGive(g_child_exit_sem);
+    CFE_ES_ExitChildTask();
+}
+
+// Stop the child tasks, then close what outlives the module: libcsp itself is
+// linked in and unloaded with it, but the interface drivers own threads and sockets
+static void BUS_COMMS_Shutdown(void)
+{
+    OS_time_t start;
+    OS_time_t now;
+    uint32    running = 0;
+    uint32    waited;
+
+    for (uint32 i = 0; i < sizeof(g_child_task_ids) / sizeof(g_child_task_ids[0]); ++i)
+    {
+        if (CFE_RESOURCEID_TEST_DEFINED(*g_child_task_ids[i]))
+        {
+            ++running;
+        }
+    }
+
+    g_children_run = false;
+    BUS_COMMS_TxqWake();
+
+    OS_GetLocalTime(&start);
+    while (running > 0)
+    {
+        OS_GetLocalTime(&now);
+        waited = (uint32)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(now, start));
+        if (waited >= BUS_COMMS_STOP_WAIT_MSEC ||
+            OS_CountSemTimedWait(g_child_exit_sem, BUS_COMMS_STOP_WAIT_MSEC - waited) != OS_SUCCESS)
+        {
+            break;
+        }
+        --running;
+    }
+
+    if (running > 0)
+    {
+        // ES deletes them with the app; their connections are left to die with libcsp, and
+        // the interfaces stay open since a leftover task may still route through them
+        CFE_ES_WriteToSysLog("BUS_COMMS: %lu child tasks did not stop, CSP interfaces left open\n",
+                             (unsigned long)running);
+    }
+    else
+    {
+        BUS_COMMS_ConnCacheClose();
+        BUS_COMMS_IfaceClose();
+    }
+}
+
 int32 BUS_COMMS_AppInit(void)
 {
     int32 status;
@@ -175,6 +227,8 @@ int32 BUS_COMMS_AppInit(void)
 
     CFE_MSG_Init(CFE_MSG_PTR(BUS_COMMS_AppData.HkTlm.TelemetryHeader), CFE_SB_ValueToMsgId(BUS_COMMS_HK_TLM_MID),
                  sizeof(BUS_COMMS_AppData.HkTlm));
+    CFE_MSG_Init(CFE_MSG_PTR(BUS_COMMS_AppData.BatchTlm.TelemetryHeader), CFE_SB_ValueToMsgId(BUS_COMMS_BATCH_TLM_MID),
+                 sizeof(BUS_COMMS_AppData.BatchTlm));
 
     status = CFE_SB_CreatePipe(&BUS_COMMS_AppData.CmdPipe, BUS_COMMS_AppData.PipeDepth, BUS_COMMS_AppData.PipeName);
     if (status != CFE_SUCCESS)
@@ -197,33 +251,92 @@ int32 BUS_COMMS_AppInit(void)
         return status;
     }
 
-    // Initialize routing table and source/SBN map
-    memset(g_routes, 0, sizeof(g_routes));
-    g_route_count = 0;
-    BUS_COMMS_SourcePipeMapInit();
+    status = BUS_COMMS_ErrEventInit();
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("BUS_COMMS: Error creating event limiter, RC = %ld\n", (long)status);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    // Interfaces, node addresses and port maps come from the table
+    status = BUS_COMMS_ConfigInit();
+    if (status != CFE_SUCCESS)
+    {
+        return status;
+    }
+
+    status = BUS_COMMS_RouteInit();
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("BUS_COMMS: Error creating routing table, RC = %ld\n", (long)status);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
 
     BUS_COMMS_SelectNodeIds();
 
-    // Initialize CSP and SocketCAN, spawn router, receiver, and periodic TX tasks
+    // Subscribe the SB-to-CSP bridge; forwarding runs in its own child task
+    status = BUS_COMMS_BridgeInit(&BUS_COMMS_AppData.Config, g_csp_dest_addr);
+    if (status != CFE_SUCCESS)
+    {
+        return status;
+    }
+
+    BUS_COMMS_ConnCacheInit();
+
+    status = BUS_COMMS_TxqInit();
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("BUS_COMMS: Error creating TX queue, RC = %ld\n", (long)status);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    status = BUS_COMMS_FragInit();
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("BUS_COMMS: Error creating reassembly pool, RC = %ld\n", (long)status);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    status = BUS_COMMS_SchedInit();
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("BUS_COMMS: Error creating schedule, RC = %ld\n", (long)status);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    status = BUS_COMMS_XferInit(BUS_COMMS_AppData.Config.XferPort);
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("BUS_COMMS: Error creating file transfer, RC = %ld\n", (long)status);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    status = BUS_COMMS_BenchInit(BUS_COMMS_AppData.Config.BenchPort);
+    if (status != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("BUS_COMMS: Error creating benchmark, RC = %ld\n", (long)status);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    BUS_COMMS_HbInit(&BUS_COMMS_AppData.Config, g_csp_my_addr);
+
+    // Rate limits, schedules and queue depth; reapplied on every table update
+    BUS_COMMS_ConfigApply(&BUS_COMMS_AppData.Config, g_csp_dest_addr);
+
+    // Initialize CSP and its interfaces, spawn router, receiver, and periodic TX tasks
     do {
-        int err;
-        csp_iface_t *iface = NULL;
+        status = OS_CountSemCreate(&g_child_exit_sem, "BC_EXIT_SEM", 0, 0);
+        if (status != OS_SUCCESS) {
+            CFE_ES_WriteToSysLog("BUS_COMMS: Error creating exit semaphore, RC = %ld\n", (long)status);
+            return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
 
         csp_init();
-        csp_dbg_packet_print = 1;
-
-        err = csp_can_socketcan_open_and_add_interface(
-            BUS_COMMS_CSP_CAN_IF,
-            CSP_IF_CAN_DEFAULT_NAME,
-            g_csp_my_addr,
-            BUS_COMMS_CSP_BITRATE,
-            false,
-            &iface);
-        if (err != CSP_ERR_NONE || iface == NULL) {
-            CFE_ES_WriteToSysLog("BUS_COMMS: CSP SocketCAN can0 open failed err=%d\n", err);
-            return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+
+        status = BUS_COMMS_IfaceInit(&BUS_COMMS_AppData.Config, g_csp_my_addr, g_csp_dest_addr);
+        if (status != CFE_SUCCESS) {
+            return status;
         }
-        iface->is_default = 1;
 
         // Router child task
         status = CFE_ES_CreateChildTask(
@@ -255,6 +368,21 @@ int32 BUS_COMMS_AppInit(void)
             return status;
         }
 
+        // Connection-less receiver for datagram ingest ports and heartbeats (exits if neither is configured)
+        status = CFE_ES_CreateChildTask(
+            &BUS_COMMS_CSP_DgramTaskId,
+            "BC_CSP_DGRAM",
+            BUS_COMMS_CSP_DgramReceiverTask,
+            NULL,
+            16384,
+            50,
+            0
+        );
+        if (status != CFE_SUCCESS) {
+            CFE_ES_WriteToSysLog("BUS_COMMS: CreateChildTask Dgram failed RC=0x%08lX\n", (unsigned long)status);
+            return status;
+        }
+
         status = CFE_ES_CreateChildTask(
             &BUS_COMMS_CSP_TxTaskId,
             "BC_CSP_TX",
@@ -269,14 +397,59 @@ int32 BUS_COMMS_AppInit(void)
             return status;
         }
 
+        // SB-to-CSP bridge: pends on the bridge pipe and queues packets for the TX task
+        status = CFE_ES_CreateChildTask(
+            &BUS_COMMS_CSP_BridgeTaskId,
+            "BC_CSP_BRIDGE",
+            BUS_COMMS_CSP_BridgeTask,
+            NULL,
+            16384,
+            55,
+            0
+        );
+        if (status != CFE_SUCCESS) {
+            CFE_ES_WriteToSysLog("BUS_COMMS: CreateChildTask Bridge failed RC=0x%08lX\n", (unsigned long)status);
+            return status;
+        }
+
+        // File transfer: below the bridge so bulk data never delays flight traffic
+        status = CFE_ES_CreateChildTask(
+            &BUS_COMMS_CSP_XferTaskId,
+            "BC_CSP_XFER",
+            BUS_COMMS_XferTask,
+            NULL,
+            16384,
+            80,
+            0
+        );
+        if (status != CFE_SUCCESS) {
+            CFE_ES_WriteToSysLog("BUS_COMMS: CreateChildTask Xfer failed RC=0x%08lX\n", (unsigned long)status);
+            return status;
+        }
+
+        // Benchmark echo/driver (exits if no BenchPort is configured)
+        status = CFE_ES_CreateChildTask(
+            &BUS_COMMS_CSP_BenchTaskId,
+            "BC_CSP_BENCH",
+            BUS_COMMS_BenchTask,
+            NULL,
+            16384,
+            70,
+            0
+        );
+        if (status != CFE_SUCCESS) {
+            CFE_ES_WriteToSysLog("BUS_COMMS: CreateChildTask Bench failed RC=0x%08lX\n", (unsigned long)status);
+            return status;
+        }
+
         
     } while (0);
 
     /* send a quick CSP ping on startup so external tools can verify connectivity */
     const char *startup_msg = "BUS_COMMS startup ping";
 
-    if (BUS_COMMS_CSP_Send(g_csp_dest_addr, BUS_COMMS_CSP_PORT, startup_msg,
-                            (uint16_t)strlen(startup_msg)) != 0)
+    if (BUS_COMMS_CSP_Send(CSP_PRIO_LOW, g_csp_dest_addr, BUS_COMMS_AppData.Config.CspPort, startup_msg,
+                            (uint16_t)strlen(startup_msg), false, 0) != 0)
     {
         CFE_ES_WriteToSysLog("BUS_COMMS: startup CSP send failed\n");
     }
@@ -323,7 +496,8 @@ void BUS_COMMS_ProcessGroundCommand(CFE_SB_Buffer_t *SBBufPtr)
             // Replace inline demo send with generic sender
             do {
                 const char * msg = "CSP hello from BUS_COMMS";
-                if (BUS_COMMS_CSP_Send(g_csp_dest_addr, BUS_COMMS_CSP_PORT, msg, (uint16_t)strlen(msg)) != 0) {
+                if (BUS_COMMS_CSP_Send(CSP_PRIO_NORM, g_csp_dest_addr, BUS_COMMS_AppData.Config.CspPort, msg,
+                                       (uint16_t)strlen(msg), false, 0) != 0) {
                     CFE_ES_WriteToSysLog("BUS_COMMS: NOOP demo send failed\n");
                 }
             } while (0);
@@ -332,6 +506,35 @@ void BUS_COMMS_ProcessGroundCommand(CFE_SB_Buffer_t *SBBufPtr)
         case BUS_COMMS_RESET_COUNTERS_CC:
             BUS_COMMS_AppData.CmdCounter = 0;
             BUS_COMMS_AppData.ErrCounter = 0;
+            BUS_COMMS_STAT_SET(ConnCacheHits, 0);
+            BUS_COMMS_STAT_SET(ConnCacheMisses, 0);
+            BUS_COMMS_STAT_SET(ConnCacheEvictions, 0);
+            BUS_COMMS_STAT_SET(BridgeForwarded, 0);
+            BUS_COMMS_STAT_SET(BridgeDropped, 0);
+            BUS_COMMS_STAT_SET(IngestPackets, 0);
+            BUS_COMMS_STAT_SET(IngestErrors, 0);
+            BUS_COMMS_STAT_SET(RouteEvictions, 0);
+            BUS_COMMS_STAT_SET(TxQueued, 0);
+            BUS_COMMS_STAT_SET(TxQueueFull, 0);
+            BUS_COMMS_STAT_SET(TxThrottled, 0);
+            BUS_COMMS_STAT_SET(TxConnErrors, 0);
+            BUS_COMMS_STAT_SET(TxDeadDrops, 0);
+            BUS_COMMS_STAT_SET(TxTimeouts, 0);
+            BUS_COMMS_STAT_SET(IfFailovers, 0);
+            BUS_COMMS_STAT_SET(CspBufPeakUsed, 0);
+            BUS_COMMS_STAT_SET(CspBufAllocFails, 0);
+            BUS_COMMS_STAT_SET(EventsSuppressed, 0);
+            BUS_COMMS_STAT_SET(FragTxMessages, 0);
+            BUS_COMMS_STAT_SET(FragRxMessages, 0);
+            BUS_COMMS_STAT_SET(FragRxDropped, 0);
+            BUS_COMMS_STAT_SET(FragRxTimeouts, 0);
+            BUS_COMMS_STAT_SET(XferTxFiles, 0);
+            BUS_COMMS_STAT_SET(XferRxFiles, 0);
+            BUS_COMMS_STAT_SET(XferTxBytes, 0);
+            BUS_COMMS_STAT_SET(XferRxBytes, 0);
+            BUS_COMMS_STAT_SET(XferRetransmits, 0);
+            BUS_COMMS_STAT_SET(XferErrors, 0);
+            BUS_COMMS_STAT_SET(XferLastRate, 0);
             CFE_EVS_SendEvent(BUS_COMMS_COMMANDRST_INF_EID, CFE_EVS_EventType_INFORMATION,
                               "BUS_COMMS: RESET command");
             break;
@@ -357,29 +560,128 @@ void BUS_COMMS_ProcessGroundCommand(CFE_SB_Buffer_t *SBBufPtr)
                 break;
             }
 
-            if (BUS_COMMS_CSP_Send(cmd->dest, cmd->port, cmd->data, len) == 0) {
+            // Returns once queued; the TX task reports completion under the command's sequence count
+            CFE_MSG_SequenceCount_t seq = 0;
+            CFE_MSG_GetSequenceCount(&SBBufPtr->Msg, &seq);
+
+            if (BUS_COMMS_CSP_Send(CSP_PRIO_NORM, cmd->dest, cmd->port, cmd->data, len, true, (uint16)seq) == 0) {
                 BUS_COMMS_AppData.CmdCounter++;
                 CFE_EVS_SendEvent(BUS_COMMS_COMMANDNOP_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "BUS_COMMS: SENT CSP to %u:%u len=%u", cmd->dest, cmd->port, len);
+                                  "BUS_COMMS: QUEUED CSP to %u:%u len=%u tag=%u", cmd->dest, cmd->port, len,
+                                  (unsigned)seq);
             } else {
                 BUS_COMMS_AppData.ErrCounter++;
             }
             break;
         }
 
-        case BUS_COMMS_LIST_ROUTES_CC: {
-            // Dump routing table to syslog
-            CFE_ES_WriteToSysLog("BUS_COMMS: Routing table entries: %u\n", g_route_count);
-            for (uint8_t i = 0; i < g_route_count; ++i) {
-                CFE_ES_WriteToSysLog("BUS_COMMS: Route[%u]: addr=%u last_port=%u rx=%lu tx=%lu\n",
-                                     (unsigned)i,
-                                     g_routes[i].addr,
-                                     (unsigned)g_routes[i].last_port,
-                                     (unsigned long)g_routes[i].rx_count,
-                                     (unsigned long)g_routes[i].tx_count);
+        case BUS_COMMS_SEND_CSP_BATCH_CC:
+            BUS_COMMS_SendCspBatchCmd(SBBufPtr);
+            break;
+
+        case BUS_COMMS_LIST_ROUTES_CC:
+            // Publish the routing table as BUS_COMMS_RouteTlm_t packets
+            BUS_COMMS_RouteSendTlm();
+            BUS_COMMS_AppData.CmdCounter++;
+            break;
+
+        case BUS_COMMS_XFER_SEND_CC: {
+            size_t total_size = 0;
+            CFE_MSG_GetSize(&SBBufPtr->Msg, &total_size);
+            if (total_size != sizeof(BUS_COMMS_XferSendCmd_t)) {
+                CFE_EVS_SendEvent(BUS_COMMS_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "BUS_COMMS: XFER_SEND invalid size (%lu)", (unsigned long) total_size);
+                BUS_COMMS_AppData.ErrCounter++;
+                break;
+            }
+
+            const BUS_COMMS_XferSendCmd_t * cmd = (const BUS_COMMS_XferSendCmd_t *) SBBufPtr;
+            char src[CFE_MISSION_MAX_PATH_LEN];
+            char dst[CFE_MISSION_MAX_PATH_LEN];
+            uint8_t dest = (cmd->Dest == BUS_COMMS_ADDR_PEER) ? g_csp_dest_addr : cmd->Dest;
+
+            if (BUS_COMMS_AppData.Config.XferPort == 0 ||
+                CFE_SB_MessageStringGet(src, cmd->SrcFilename, NULL, sizeof(src), sizeof(cmd->SrcFilename)) <= 0 ||
+                CFE_SB_MessageStringGet(dst, cmd->DstFilename, NULL, sizeof(dst), sizeof(cmd->DstFilename)) <= 0) {
+                CFE_EVS_SendEvent(BUS_COMMS_XFER_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "BUS_COMMS: XFER_SEND rejected, transfer disabled or empty filename");
+                BUS_COMMS_AppData.ErrCounter++;
+                break;
+            }
+
+            // The transfer task picks the request up on its next pass
+            if (BUS_COMMS_XferRequest(dest, src, dst) == CFE_SUCCESS) {
+                BUS_COMMS_AppData.CmdCounter++;
+            } else {
+                CFE_EVS_SendEvent(BUS_COMMS_XFER_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "BUS_COMMS: XFER_SEND rejected, a send is already in progress");
+                BUS_COMMS_AppData.ErrCounter++;
+            }
+            break;
+        }
+
+        case BUS_COMMS_BENCH_CC: {
+            size_t total_size = 0;
+            CFE_MSG_GetSize(&SBBufPtr->Msg, &total_size);
+            if (total_size != sizeof(BUS_COMMS_BenchCmd_t)) {
+                CFE_EVS_SendEvent(BUS_COMMS_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "BUS_COMMS: BENCH invalid size (%lu)", (unsigned long) total_size);
+                BUS_COMMS_AppData.ErrCounter++;
+                break;
+            }
+
+            const BUS_COMMS_BenchCmd_t * cmd = (const BUS_COMMS_BenchCmd_t *) SBBufPtr;
+            uint8 dests[BUS_COMMS_BENCH_MAX_DESTS];
+
+            if (BUS_COMMS_AppData.Config.BenchPort == 0 || cmd->Count == 0 ||
+                cmd->Count > BUS_COMMS_BENCH_MAX_PACKETS || cmd->PayloadLen < BUS_COMMS_BENCH_HDR_LEN ||
+                cmd->PayloadLen > csp_buffer_data_size() || cmd->DestCount == 0 ||
+                cmd->DestCount > BUS_COMMS_BENCH_MAX_DESTS) {
+                CFE_EVS_SendEvent(BUS_COMMS_COMMAND_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "BUS_COMMS: BENCH rejected count=%u len=%u dests=%u", (unsigned)cmd->Count,
+                                  (unsigned)cmd->PayloadLen, (unsigned)cmd->DestCount);
+                BUS_COMMS_AppData.ErrCounter++;
+                break;
+            }
+
+            for (uint8 i = 0; i < cmd->DestCount; ++i) {
+                dests[i] = (cmd->Dests[i] == BUS_COMMS_ADDR_PEER) ? g_csp_dest_addr : cmd->Dests[i];
+            }
+
+            if (BUS_COMMS_BenchRequest(cmd->Count, cmd->PayloadLen, cmd->RateHz, cmd->DestCount, dests) ==
+                CFE_SUCCESS) {
+                BUS_COMMS_AppData.CmdCounter++;
+            } else {
+                CFE_EVS_SendEvent(BUS_COMMS_COMMAND_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "BUS_COMMS: BENCH rejected, a run is already in progress");
+                BUS_COMMS_AppData.ErrCounter++;
             }
+            break;
+        }
+
+        case BUS_COMMS_XFER_ABORT_CC:
+            BUS_COMMS_XferAbort();
             BUS_COMMS_AppData.CmdCounter++;
             break;
+
+        case BUS_COMMS_WRITE_ROUTES_CC: {
+            size_t total_size = 0;
+            CFE_MSG_GetSize(&SBBufPtr->Msg, &total_size);
+            if (total_size != sizeof(BUS_COMMS_WriteRoutesCmd_t)) {
+                CFE_EVS_SendEvent(BUS_COMMS_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "BUS_COMMS: WRITE_ROUTES invalid size (%lu)", (unsigned long) total_size);
+                BUS_COMMS_AppData.ErrCounter++;
+                break;
+            }
+
+            // The file itself is written by the ES background task
+            const BUS_COMMS_WriteRoutesCmd_t * cmd = (const BUS_COMMS_WriteRoutesCmd_t *) SBBufPtr;
+            if (BUS_COMMS_RouteWriteFile(cmd->Filename, sizeof(cmd->Filename)) == CFE_SUCCESS) {
+                BUS_COMMS_AppData.CmdCounter++;
+            } else {
+                BUS_COMMS_AppData.ErrCounter++;
+            }
+            break;
         }
 
         default:
@@ -395,174 +697,368 @@ int32 BUS_COMMS_ReportHousekeeping(const CFE_MSG_CommandHeader_t *Msg)
     BUS_COMMS_AppData.HkTlm.Payload.CommandErrorCounter = BUS_COMMS_AppData.ErrCounter;
     BUS_COMMS_AppData.HkTlm.Payload.CommandCounter      = BUS_COMMS_AppData.CmdCounter;
 
+    /* Age out silent nodes and stale reassemblies even when idle */
+    BUS_COMMS_RouteAge();
+    BUS_COMMS_FragSweep();
+
+    // Validate and activate pending table loads
+    BUS_COMMS_ConfigManage(g_csp_dest_addr);
+
+    BUS_COMMS_AppData.HkTlm.Payload.ConnCacheHits      = BUS_COMMS_STAT_GET(ConnCacheHits);
+    BUS_COMMS_AppData.HkTlm.Payload.ConnCacheMisses    = BUS_COMMS_STAT_GET(ConnCacheMisses);
+    BUS_COMMS_AppData.HkTlm.Payload.ConnCacheEvictions = BUS_COMMS_STAT_GET(ConnCacheEvictions);
+    BUS_COMMS_AppData.HkTlm.Payload.BridgeForwarded    = BUS_COMMS_STAT_GET(BridgeForwarded);
+    BUS_COMMS_AppData.HkTlm.Payload.BridgeDropped      = BUS_COMMS_STAT_GET(BridgeDropped);
+    BUS_COMMS_AppData.HkTlm.Payload.IngestPackets      = BUS_COMMS_STAT_GET(IngestPackets);
+    BUS_COMMS_AppData.HkTlm.Payload.IngestErrors       = BUS_COMMS_STAT_GET(IngestErrors);
+    BUS_COMMS_AppData.HkTlm.Payload.RouteCount         = BUS_COMMS_STAT_GET(RouteCount);
+    BUS_COMMS_AppData.HkTlm.Payload.RouteEvictions     = BUS_COMMS_STAT_GET(RouteEvictions);
+    BUS_COMMS_AppData.HkTlm.Payload.TxQueued           = BUS_COMMS_STAT_GET(TxQueued);
+    BUS_COMMS_AppData.HkTlm.Payload.TxQueueFull        = BUS_COMMS_STAT_GET(TxQueueFull);
+    BUS_COMMS_AppData.HkTlm.Payload.TxThrottled        = BUS_COMMS_STAT_GET(TxThrottled);
+    BUS_COMMS_AppData.HkTlm.Payload.TxConnErrors       = BUS_COMMS_STAT_GET(TxConnErrors);
+    BUS_COMMS_AppData.HkTlm.Payload.TxDeadDrops        = BUS_COMMS_STAT_GET(TxDeadDrops);
+    BUS_COMMS_AppData.HkTlm.Payload.TxTimeouts         = BUS_COMMS_STAT_GET(TxTimeouts);
+    BUS_COMMS_AppData.HkTlm.Payload.IfFailovers        = BUS_COMMS_STAT_GET(IfFailovers);
+    BUS_COMMS_AppData.HkTlm.Payload.CspBufAllocFails   = BUS_COMMS_STAT_GET(CspBufAllocFails);
+    BUS_COMMS_AppData.HkTlm.Payload.EventsSuppressed   = BUS_COMMS_STAT_GET(EventsSuppressed);
+    BUS_COMMS_BufReport(&BUS_COMMS_AppData.HkTlm.Payload.CspBufTotal, &BUS_COMMS_AppData.HkTlm.Payload.CspBufFree,
+                        &BUS_COMMS_AppData.HkTlm.Payload.CspBufPeakUsed);
+    BUS_COMMS_AppData.HkTlm.Payload.RouterPackets      = BUS_COMMS_STAT_GET(RouterPackets);
+    BUS_COMMS_AppData.HkTlm.Payload.RouterIdlePasses   = BUS_COMMS_STAT_GET(RouterIdlePasses);
+    BUS_COMMS_AppData.HkTlm.Payload.FragTxMessages     = BUS_COMMS_STAT_GET(FragTxMessages);
+    BUS_COMMS_AppData.HkTlm.Payload.FragRxMessages     = BUS_COMMS_STAT_GET(FragRxMessages);
+    BUS_COMMS_AppData.HkTlm.Payload.FragRxDropped      = BUS_COMMS_STAT_GET(FragRxDropped);
+    BUS_COMMS_AppData.HkTlm.Payload.FragRxTimeouts     = BUS_COMMS_STAT_GET(FragRxTimeouts);
+    BUS_COMMS_AppData.HkTlm.Payload.XferTxFiles        = BUS_COMMS_STAT_GET(XferTxFiles);
+    BUS_COMMS_AppData.HkTlm.Payload.XferRxFiles        = BUS_COMMS_STAT_GET(XferRxFiles);
+    BUS_COMMS_AppData.HkTlm.Payload.XferTxBytes        = BUS_COMMS_STAT_GET(XferTxBytes);
+    BUS_COMMS_AppData.HkTlm.Payload.XferRxBytes        = BUS_COMMS_STAT_GET(XferRxBytes);
+    BUS_COMMS_AppData.HkTlm.Payload.XferRetransmits    = BUS_COMMS_STAT_GET(XferRetransmits);
+    BUS_COMMS_AppData.HkTlm.Payload.XferErrors         = BUS_COMMS_STAT_GET(XferErrors);
+    BUS_COMMS_AppData.HkTlm.Payload.XferLastRate       = BUS_COMMS_STAT_GET(XferLastRate);
+
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(BUS_COMMS_AppData.HkTlm.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(BUS_COMMS_AppData.HkTlm.TelemetryHeader), true);
 
     return CFE_SUCCESS;
 }
 
-// Child task: CSP router
+// SEND_CSP_BATCH: unpack the records, queue them and report per-record status
+static void BUS_COMMS_SendCspBatchCmd(const CFE_SB_Buffer_t *SBBufPtr)
+{
+    const BUS_COMMS_SendCspBatchCmd_t *cmd = (const BUS_COMMS_SendCspBatchCmd_t *)SBBufPtr;
+    BUS_COMMS_BatchStatusTlm_t        *tlm = &BUS_COMMS_AppData.BatchTlm;
+    BUS_COMMS_BatchRecordHdr_t         hdr;
+    csp_packet_t                      *packet;
+    size_t                             total_size = 0;
+    size_t                             data_len;
+    size_t                             offset = 0;
+    uint32                             sent   = 0;
+    uint32                             i;
+
+    CFE_MSG_GetSize(&SBBufPtr->Msg, &total_size);
+    if (total_size < offsetof(BUS_COMMS_SendCspBatchCmd_t, Records) || total_size > sizeof(*cmd) ||
+        cmd->RecordCount == 0 || cmd->RecordCount > BUS_COMMS_MAX_BATCH_RECORDS)
+    {
+        CFE_EVS_SendEvent(BUS_COMMS_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "BUS_COMMS: SEND_CSP_BATCH invalid size=%lu count=%u", (unsigned long)total_size,
+                          (total_size < offsetof(BUS_COMMS_SendCspBatchCmd_t, Records)) ? 0u : (unsigned)cmd->RecordCount);
+        BUS_COMMS_AppData.ErrCounter++;
+        return;
+    }
+
+    data_len = total_size - offsetof(BUS_COMMS_SendCspBatchCmd_t, Records);
+
+    memset(tlm->Payload.Status, BUS_COMMS_BATCH_BAD_LENGTH, sizeof(tlm->Payload.Status));
+    tlm->Payload.BatchId     = cmd->BatchId;
+    tlm->Payload.RecordCount = cmd->RecordCount;
+
+    // Records are packed back to back and not aligned, so headers are copied out
+    for (i = 0; i < cmd->RecordCount; ++i)
+    {
+        if (offset + sizeof(hdr) > data_len)
+        {
+            break;
+        }
+
+        memcpy(&hdr, &cmd->Records[offset], sizeof(hdr));
+        offset += sizeof(hdr);
+
+        if (offset + hdr.Len > data_len)
+        {
+            break;
+        }
+
+        if (hdr.Len > 0 && hdr.Len <= BUS_COMMS_MAX_SEND_LEN)
+        {
+            // Consecutive records to one node are coalesced by the TX task's service pass
+            packet = BUS_COMMS_BufGet(hdr.Len, 0);
+            if (packet == NULL)
+            {
+                tlm->Payload.Status[i] = BUS_COMMS_BATCH_NO_BUFFER;
+            }
+            else
+            {
+                memcpy(packet->data, &cmd->Records[offset], hdr.Len);
+                packet->length = hdr.Len;
+
+                if (BUS_COMMS_TxqPushCmd(CSP_PRIO_NORM, hdr.Dest, hdr.Port, packet, cmd->BatchId) == 0)
+                {
+                    tlm->Payload.Status[i] = BUS_COMMS_BATCH_QUEUED;
+                    ++sent;
+                }
+                else
+                {
+                    tlm->Payload.Status[i] = BUS_COMMS_BATCH_QUEUE_FULL;
+                }
+            }
+        }
+
+        offset += hdr.Len;
+    }
+
+    tlm->Payload.SentCount = (uint8)sent;
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(tlm->TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(tlm->TelemetryHeader), true);
+
+    if (sent == cmd->RecordCount)
+    {
+        BUS_COMMS_AppData.CmdCounter++;
+    }
+    else
+    {
+        BUS_COMMS_AppData.ErrCounter++;
+    }
+
+    CFE_EVS_SendEvent(BUS_COMMS_BATCH_INF_EID,
+                      (sent == cmd->RecordCount) ? CFE_EVS_EventType_INFORMATION : CFE_EVS_EventType_ERROR,
+                      "BUS_COMMS: SEND_CSP_BATCH id=%u queued %lu of %u records", (unsigned)cmd->BatchId,
+                      (unsigned long)sent, (unsigned)cmd->RecordCount);
+}
+
+// Child task: CSP router.  csp_route_work() blocks on libcsp's input queue
+// with a bounded timeout, so an idle bus costs one wakeup per timeout.  Route
+// moves asked for by the heartbeat are applied here, between passes.
 static void BUS_COMMS_CSP_RouterTask(void)
 {
-    for (;;)
+    int err;
+
+    while (BUS_COMMS_Running())
     {
-        csp_route_work();
+        // libcsp waits for input and routes in one call, so the perf marker
+        // covers only this task's own work between passes
+        err = csp_route_work();
+
+        CFE_ES_PerfLogEntry(BUS_COMMS_ROUTER_PERF_ID);
+
+        if (err == CSP_ERR_NONE)
+        {
+            BUS_COMMS_STAT_INC(RouterPackets);
+        }
+        else if (err == CSP_ERR_TIMEDOUT)
+        {
+            BUS_COMMS_STAT_INC(RouterIdlePasses);
+        }
+
+        BUS_COMMS_IfaceApply();
+
+        CFE_ES_PerfLogExit(BUS_COMMS_ROUTER_PERF_ID);
+
+        if (err != CSP_ERR_NONE && err != CSP_ERR_TIMEDOUT)
+        {
+            // Never spin if the router fails without waiting
+            OS_TaskDelay(BUS_COMMS_ROUTER_ERR_DELAY_MSEC);
+        }
     }
-    CFE_ES_ExitChildTask();
+    BUS_COMMS_ChildExit();
 }
 
-// Child task: CSP receiver (like your receiver.c)
+// Child task: CSP receiver, publishes mapped ports on the software bus
 static void BUS_COMMS_CSP_ReceiverTask(void)
 {
-    csp_socket_t sock = {0};
-    csp_bind(&sock, BUS_COMMS_CSP_PORT);
+    csp_socket_t     sock             = {0};
+    CFE_SB_Buffer_t *NextIngestBufPtr = NULL;
+
+    csp_bind(&sock, BUS_COMMS_AppData.Config.CspPort);
+    BUS_COMMS_BridgeBindIngestPorts(&sock, BUS_COMMS_PORT_MODE_CONN);
     csp_listen(&sock, 5);
 
-    for (;;)
+    while (BUS_COMMS_Running())
     {
-        csp_conn_t *conn = csp_accept(&sock, 1000);
+        csp_conn_t *conn = csp_accept(&sock, BUS_COMMS_STOP_POLL_MSEC);
         if (conn == NULL) {
             continue;
         }
 
+        // Source address and dport feed the routing table
+        uint8_t src = csp_conn_src(conn);
+        uint16_t dport = csp_conn_dport(conn);
+
+        CFE_ES_PerfLogEntry(BUS_COMMS_RX_PERF_ID);
+
+        // First packet may still be in flight; anything queued behind it is drained without waiting
         csp_packet_t *packet = csp_read(conn, 1000);
-        if (packet) {
-            // Update routing table based on source address and dport
-            uint8_t src = csp_conn_src(conn);
-            uint16_t dport = csp_conn_dport(conn);
-            BUS_COMMS_RouteUpdateRx(src, dport);
-
-            CFE_ES_WriteToSysLog("BUS_COMMS: CSP RX from %u:%u: %.*s\n",
-                                 src, dport, packet->length, (char *)packet->data);
-            csp_buffer_free(packet);
+        while (packet) {
+            BUS_COMMS_RouteUpdateRx(src, dport, packet->length);
+            BUS_COMMS_BridgeIngest(&NextIngestBufPtr, packet, (uint8_t)dport);
+            packet = csp_read(conn, 0);
         }
 
         csp_close(conn);
+
+        CFE_ES_PerfLogExit(BUS_COMMS_RX_PERF_ID);
     }
-    CFE_ES_ExitChildTask();
+    BUS_COMMS_ChildExit();
 }
 
-// Child task: periodic CSP transmitter
-static void BUS_COMMS_CSP_TxTask(void)
+// Child task: connection-less CSP receiver, drains a burst of datagrams per wakeup
+static void BUS_COMMS_CSP_DgramReceiverTask(void)
 {
-    const char payload[] = "BUS_COMMS periodic ping";
-    int        delay_ticks = 0;
+    csp_socket_t     sock             = {.opts = CSP_SO_CONN_LESS};
+    CFE_SB_Buffer_t *NextIngestBufPtr = NULL;
+    uint32           bound            = BUS_COMMS_BridgeBindIngestPorts(&sock, BUS_COMMS_PORT_MODE_DGRAM);
+    uint8_t          hb_port          = BUS_COMMS_AppData.Config.HbPort;
 
-    while (1)
+    if (hb_port != 0)
     {
-        if (BUS_COMMS_CSP_Send(g_csp_dest_addr, BUS_COMMS_CSP_PORT, payload, (uint16_t)(sizeof(payload) - 1)) != 0)
+        if (csp_bind(&sock, hb_port) != CSP_ERR_NONE)
         {
-            CFE_ES_WriteToSysLog("BUS_COMMS: periodic CSP send failed\n");
+            CFE_ES_WriteToSysLog("BUS_COMMS: csp_bind failed for heartbeat port %u\n", (unsigned)hb_port);
         }
-
-        if (OS_Milli2Ticks(25000, &delay_ticks) != OS_SUCCESS || delay_ticks <= 0)
+        else
         {
-            delay_ticks = 25000;
+            ++bound;
         }
+    }
 
-        OS_TaskDelay((uint32)delay_ticks);
+    if (bound == 0)
+    {
+        BUS_COMMS_ChildExit();
+        return;
     }
 
-    CFE_ES_ExitChildTask();
-}
+    while (BUS_COMMS_Running())
+    {
+        csp_packet_t *packet = csp_recvfrom(&sock, BUS_COMMS_DGRAM_RX_TIMEOUT);
+        uint32        count  = 0;
+
+        if (packet == NULL)
+        {
+            continue;
+        }
 
+        CFE_ES_PerfLogEntry(BUS_COMMS_RX_PERF_ID);
 
-static int BUS_COMMS_RouteFindOrAdd(uint8_t addr) {
-    for (uint8_t i = 0; i < g_route_count; ++i) {
-        if (g_routes[i].addr == addr) {
-            return i;
+        while (packet != NULL)
+        {
+            BUS_COMMS_RouteUpdateRx((uint8_t)packet->id.src, packet->id.dport, packet->length);
+
+            if (hb_port != 0 && packet->id.dport == hb_port)
+            {
+                BUS_COMMS_HbReceive(packet);
+            }
+            else
+            {
+                BUS_COMMS_BridgeIngest(&NextIngestBufPtr, packet, packet->id.dport);
+            }
+
+            if (++count >= BUS_COMMS_DGRAM_MAX_BURST)
+            {
+                break;
+            }
+            packet = csp_recvfrom(&sock, 0);
         }
-    }
-    if (g_route_count < BUS_COMMS_MAX_ROUTES) {
-        g_routes[g_route_count].addr = addr;
-        g_routes[g_route_count].last_port = 0;
-        g_routes[g_route_count].rx_count = 0;
-        g_routes[g_route_count].tx_count = 0;
-        g_routes[g_route_count].last_seen = CFE_TIME_GetTime();
-        return g_route_count++;
-    }
-    return -1;
-}
 
-static void BUS_COMMS_RouteUpdateRx(uint8_t addr, uint16_t port) {
-    int idx = BUS_COMMS_RouteFindOrAdd(addr);
-    if (idx >= 0) {
-        g_routes[idx].rx_count++;
-        g_routes[idx].last_port = port;
-        g_routes[idx].last_seen = CFE_TIME_GetTime();
+        CFE_ES_PerfLogExit(BUS_COMMS_RX_PERF_ID);
     }
+    BUS_COMMS_ChildExit();
 }
 
-static void BUS_COMMS_RouteUpdateTx(uint8_t addr, uint16_t port) {
-    int idx = BUS_COMMS_RouteFindOrAdd(addr);
-    if (idx >= 0) {
-        g_routes[idx].tx_count++;
-        g_routes[idx].last_port = port;
-        g_routes[idx].last_seen = CFE_TIME_GetTime();
+// Child task: SB-to-CSP bridge
+static void BUS_COMMS_CSP_BridgeTask(void)
+{
+    while (BUS_COMMS_Running())
+    {
+        BUS_COMMS_BridgeProcess(BUS_COMMS_BRIDGE_PEND_MSEC);
     }
+    BUS_COMMS_ChildExit();
 }
 
-// Generic CSP sender with accounting
-static int BUS_COMMS_CSP_Send(uint8_t dest, uint8_t port, const void * data, uint16_t len) {
-    if (len == 0 || data == NULL) {
-        CFE_ES_WriteToSysLog("BUS_COMMS: CSP send invalid params\n");
-        return -1;
-    }
+// Child task: drains the TX queue and queues the table's periodic sends
+static void BUS_COMMS_CSP_TxTask(void)
+{
+    // Woken by BUS_COMMS_TxqWake() at shutdown
+    while (BUS_COMMS_Running())
+    {
+        uint32 sched_wait = BUS_COMMS_SchedRun();
+        uint32 hb_wait    = BUS_COMMS_HbRun();
+
+        // The connection cache is ours, so idle connections are closed here too
+        BUS_COMMS_ConnCacheSweep();
 
-    // Placeholder to demonstrate how a source/SBN mapping lookup could be incorporated later on.
-    // Today we use the message ID associated with the command pipe since actual mappings are TBD.
-    const BUS_COMMS_SourcePipeMapEntry_t *map_entry = BUS_COMMS_SourceToSbnMap(CFE_SB_ValueToMsgId(BUS_COMMS_CMD_MID));
-    if (map_entry == NULL && !g_missing_sbn_map_logged) {
-        g_missing_sbn_map_logged = true;
-        CFE_ES_WriteToSysLog("BUS_COMMS: no SBN map entry for command MID\n");
+        // Sleeps on the queue when nothing is sendable, at most until the next periodic send or heartbeat
+        BUS_COMMS_TxqService((sched_wait < hb_wait) ? sched_wait : hb_wait);
     }
 
-    csp_conn_t *conn = csp_connect(CSP_PRIO_NORM, dest, port, 1000, CSP_O_NONE);
-    if (conn == NULL) {
-        CFE_ES_WriteToSysLog("BUS_COMMS: csp_connect failed (dest=%u,port=%u)\n", dest, port);
+    BUS_COMMS_ChildExit();
+}
+
+
+// Generic CSP sender: copies the payload and queues it for the TX task.  With 'report'
+// the send is bounded by the command budget and its outcome published under 'tag'.
+static int BUS_COMMS_CSP_Send(uint8_t prio, uint8_t dest, uint8_t port, const void * data, uint16_t len,
+                              bool report, uint16 tag) {
+    if (len == 0 || data == NULL) {
         return -1;
     }
 
-    csp_packet_t *packet = csp_buffer_get(len);
+    csp_packet_t *packet = BUS_COMMS_BufGet(len, 0);
     if (packet == NULL) {
-        CFE_ES_WriteToSysLog("BUS_COMMS: buffer get failed len=%u\n", len);
-        csp_close(conn);
         return -1;
     }
 
     memcpy(packet->data, data, len);
     packet->length = len;
 
-    // libcsp in your build returns void from csp_send; it takes ownership of 'packet'
-    csp_send(conn, packet);
+    if (report) {
+        return BUS_COMMS_TxqPushCmd(prio, dest, port, packet, tag);
+    }
+    return BUS_COMMS_TxqPush(prio, dest, port, BUS_COMMS_PORT_MODE_CONN, packet);
+}
 
-    BUS_COMMS_RouteUpdateTx(dest, port);
-    csp_close(conn);
-    return 0;
+// Connection-less send for datagram ports; takes ownership of 'packet'
+void BUS_COMMS_CSP_SendDatagram(uint8_t prio, uint8_t dest, uint8_t port, csp_packet_t *packet) {
+    uint16_t len = packet->length;
+
+    csp_sendto(prio, dest, port, port, CSP_O_NONE, packet);
+    BUS_COMMS_RouteUpdateTx(dest, port, len);
 }
 
-// ------------------ Source/SBN mapping helpers ------------------
+// ------------------ Node selection ------------------
 
 static void BUS_COMMS_SelectNodeIds(void)
 {
-    uint32 cpu_id = CFE_PSP_GetProcessorId();
+    uint32                          cpu_id = CFE_PSP_GetProcessorId();
+
+    const BUS_COMMS_NodeMapEntry_t *node   = &BUS_COMMS_AppData.Config.DefaultNode;
 
-    switch (cpu_id)
+    for (size_t i = 0; i < BUS_COMMS_MAX_NODE_MAPPINGS; ++i)
     {
-        case 1:
-            g_csp_my_addr   = 1;
-            g_csp_dest_addr = 2;
+        if (BUS_COMMS_AppData.Config.NodeMap[i].InUse && BUS_COMMS_AppData.Config.NodeMap[i].ProcessorId == cpu_id)
+        {
+            node = &BUS_COMMS_AppData.Config.NodeMap[i];
             break;
+        }
+    }
 
-        case 2:
-            g_csp_my_addr   = 2;
-            g_csp_dest_addr = 1;
-            break;
+    g_csp_my_addr   = node->MyAddr;
+    g_csp_dest_addr = node->PeerAddr;
 
-        default:
-            g_csp_my_addr   = BUS_COMMS_CSP_MY_ADDR;
-            g_csp_dest_addr = BUS_COMMS_CSP_DEST_ADDR;
-            break;
+    if (BUS_COMMS_IfaceLoopbackOnly(&BUS_COMMS_AppData.Config))
+    {
+        g_csp_dest_addr = g_csp_my_addr;
     }
 
     CFE_ES_WriteToSysLog("BUS_COMMS: CPU=%lu my=%u dest=%u\n",
@@ -570,27 +1066,3 @@ static void BUS_COMMS_SelectNodeIds(void)
                          (unsigned)g_csp_my_addr,
                          (unsigned)g_csp_dest_addr);
 }
-
-static void BUS_COMMS_SourcePipeMapInit(void)
-{
-    memset(g_source_pipe_map, 0, sizeof(g_source_pipe_map));
-
-    // Default entry demonstrating how mappings can be pre-seeded.
-    g_source_pipe_map[0].SourceMsgId          = CFE_SB_ValueToMsgId(BUS_COMMS_CMD_MID);
-    g_source_pipe_map[0].SbnPublisherPipeId   = 0; /* placeholder */
-    g_source_pipe_map[0].SbnSubscriberPipeId  = 0; /* placeholder */
-    g_source_pipe_map[0].InUse                = true;
-}
-
-static const BUS_COMMS_SourcePipeMapEntry_t * BUS_COMMS_SourceToSbnMap(CFE_SB_MsgId_t msg_id)
-{
-    for (size_t i = 0; i < BUS_COMMS_MAX_SOURCE_MAPPINGS; ++i)
-    {
-        if (g_source_pipe_map[i].InUse && CFE_SB_MsgId_Equal(g_source_pipe_map[i].SourceMsgId, msg_id))
-        {
-            return &g_source_pipe_map[i];
-        }
-    }
-
-    return NULL;
-}
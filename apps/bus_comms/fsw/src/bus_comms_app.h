@@ -14,15 +14,95 @@
 #include "bus_comms_perfids.h"
 #include "bus_comms_msgids.h"
 #include "bus_comms_msg.h"
+#include "bus_comms_table.h"
+
+#include <csp/csp.h>
 
 #define BUS_COMMS_APP_PIPE_DEPTH 32
 
+/* Longest idle wait of a child task, and so its reaction time to a stop */
+#define BUS_COMMS_STOP_POLL_MSEC 250
+
+/*
+ * Concurrency model.  CmdCounter, ErrCounter and everything from TblHandle
+ * down belong to the main task, except Config, which is written before
+ * the child tasks start and only read afterwards (as are the node
+ * addresses chosen at startup).  The uint32 statistics in between are
+ * written by the router, RX, TX, bridge, transfer and benchmark tasks,
+ * many by more than one, and are reset and reported by the main task:
+ * they are only touched through the BUS_COMMS_STAT_* macros, which are
+ * relaxed atomic operations.  No increment is lost, HK never reads a torn
+ * value and the packet path takes no lock for them; HK is a set of
+ * independent samples, not a consistent snapshot.  Tables shared between
+ * tasks (routes, TX queue, reassembly slots) are guarded by their own
+ * module's mutex, held only for table updates; the connection cache
+ * belongs to the TX task and has no lock.  libcsp's routing table is read
+ * by the router task and by the TX task, the only task that sends.  After
+ * init only the router task changes it, applying the failovers the TX
+ * task requests between csp_route_work() passes; no lock is held across
+ * libcsp's blocking wait.
+ *
+ * Shutdown is cooperative: once the main task leaves its run loop, every
+ * child task sees BUS_COMMS_Running() turn false within one of its bounded
+ * waits (BUS_COMMS_STOP_POLL_MSEC when idle) and leaves through
+ * BUS_COMMS_ChildExit(), after which the main task closes the
+ * connection cache and the CSP interfaces.  If any child task is still
+ * running after BUS_COMMS_STOP_WAIT_MSEC both are left open, since that
+ * task may still be using them.
+ */
 typedef struct
 {
     uint8 CmdCounter;
     uint8 ErrCounter;
 
-    BUS_COMMS_HkTlm_t HkTlm;
+    uint32 ConnCacheHits;
+    uint32 ConnCacheMisses;
+    uint32 ConnCacheEvictions;
+
+    uint32 BridgeForwarded;
+    uint32 BridgeDropped;
+
+    uint32 IngestPackets;
+    uint32 IngestErrors;
+
+    uint32 RouteCount;
+    uint32 RouteEvictions;
+
+    uint32 TxQueued;
+    uint32 TxQueueFull;
+    uint32 TxThrottled;
+    uint32 TxConnErrors;
+    uint32 TxDeadDrops; /* connection sends skipped because the node is dead */
+    uint32 TxTimeouts;  /* command sends dropped when their budget ran out */
+
+    uint32 IfFailovers; /* node routes moved to their other interface */
+
+    uint32 CspBufPeakUsed;   /* most CSP buffers in use since reset, pool-wide */
+    uint32 CspBufAllocFails; /* BUS_COMMS_BufGet() calls that got no buffer */
+
+    uint32 EventsSuppressed; /* error events held back by BUS_COMMS_ErrEvent() */
+
+    uint32 RouterPackets;
+    uint32 RouterIdlePasses;
+
+    uint32 FragTxMessages;
+    uint32 FragRxMessages;
+    uint32 FragRxDropped;
+    uint32 FragRxTimeouts;
+
+    uint32 XferTxFiles;
+    uint32 XferRxFiles;
+    uint32 XferTxBytes;
+    uint32 XferRxBytes;
+    uint32 XferRetransmits;
+    uint32 XferErrors;
+    uint32 XferLastRate;
+
+    CFE_TBL_Handle_t  TblHandle;
+    BUS_COMMS_Table_t Config; /* table contents at startup */
+
+    BUS_COMMS_HkTlm_t          HkTlm;
+    BUS_COMMS_BatchStatusTlm_t BatchTlm;
 
     uint32 RunStatus;
 
@@ -34,10 +114,50 @@ typedef struct
 
 extern BUS_COMMS_AppData_t BUS_COMMS_AppData;
 
-void  BUS_COMMS_AppMain(void);
-int32 BUS_COMMS_AppInit(void);
-void  BUS_COMMS_ProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr);
-void  BUS_COMMS_ProcessGroundCommand(CFE_SB_Buffer_t *SBBufPtr);
-int32 BUS_COMMS_ReportHousekeeping(const CFE_MSG_CommandHeader_t *Msg);
+#if defined(__GNUC__)
+#define BUS_COMMS_STAT_ADD(Field, n) ((void)__atomic_fetch_add(&BUS_COMMS_AppData.Field, (n), __ATOMIC_RELAXED))
+#define BUS_COMMS_STAT_SUB(Field, n) ((void)__atomic_fetch_sub(&BUS_COMMS_AppData.Field, (n), __ATOMIC_RELAXED))
+#define BUS_COMMS_STAT_GET(Field)    __atomic_load_n(&BUS_COMMS_AppData.Field, __ATOMIC_RELAXED)
+#define BUS_COMMS_STAT_SET(Field, v) __atomic_store_n(&BUS_COMMS_AppData.Field, (v), __ATOMIC_RELAXED)
+#else
+/* Without the builtins only single-core targets are safe */
+#define BUS_COMMS_STAT_ADD(Field, n) ((void)(BUS_COMMS_AppData.Field += (n)))
+#define BUS_COMMS_STAT_SUB(Field, n) ((void)(BUS_COMMS_AppData.Field -= (n)))
+#define BUS_COMMS_STAT_GET(Field)    (BUS_COMMS_AppData.Field)
+#define BUS_COMMS_STAT_SET(Field, v) ((void)(BUS_COMMS_AppData.Field = (v)))
+#endif
+
+#define BUS_COMMS_STAT_INC(Field)    BUS_COMMS_STAT_ADD(Field, 1)
+#define BUS_COMMS_STAT_MAX(Field, v) BUS_COMMS_StatMax(&BUS_COMMS_AppData.Field, (v))
+
+/* Raise *Stat to Value unless it is already higher */
+static inline void BUS_COMMS_StatMax(uint32 *Stat, uint32 Value)
+{
+#if defined(__GNUC__)
+    uint32 cur = __atomic_load_n(Stat, __ATOMIC_RELAXED);
+
+    while (Value > cur && !__atomic_compare_exchange_n(Stat, &cur, Value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+#else
+    if (Value > *Stat)
+    {
+        *Stat = Value;
+    }
+#endif
+}
+
+void   BUS_COMMS_AppMain(void);
+int32  BUS_COMMS_AppInit(void);
+void   BUS_COMMS_ProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr);
+void   BUS_COMMS_ProcessGroundCommand(CFE_SB_Buffer_t *SBBufPtr);
+int32  BUS_COMMS_ReportHousekeeping(const CFE_MSG_CommandHeader_t *Msg);
+void   BUS_COMMS_CSP_SendDatagram(uint8_t prio, uint8_t dest, uint8_t port, csp_packet_t *packet);
+
+/* False once the app is stopping; child task loops test it each pass */
+bool BUS_COMMS_Running(void);
+
+/* Leave a child task, reporting the exit to the main task's shutdown */
+void BUS_COMMS_ChildExit(void);
 
 #endif /* BUS_COMMS_APP_H */
@@ -0,0 +1,302 @@
+/************************************************************************
+ * Bus Communications App - throughput/latency benchmark
+ ************************************************************************/
+
+#include "bus_comms_app.h"
+#include "bus_comms_bench.h"
+#include "bus_comms_buf.h"
+#include "bus_comms_events.h"
+#include "bus_comms_txq.h"
+#include "bus_comms_wire.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "osapi.h"
+
+#define BUS_COMMS_BENCH_PKT_REQUEST 1
+#define BUS_COMMS_BENCH_PKT_REPLY   2
+
+#define BUS_COMMS_BENCH_IDLE_MSEC BUS_COMMS_STOP_POLL_MSEC
+
+/* Run parameters handed from the command pipe to the benchmark task */
+typedef struct
+{
+    bool   pending;
+    bool   running;
+    uint16 count;
+    uint16 len;
+    uint32 rate;
+    uint8  ndests;
+    uint8  dests[BUS_COMMS_BENCH_MAX_DESTS];
+} BUS_COMMS_BenchRequest_t;
+
+static BUS_COMMS_BenchRequest_t g_bench_req;
+static osal_id_t                g_bench_mutex;
+static uint8_t                  g_bench_port;
+static uint16                   g_bench_run_id;
+
+/* Owned by the benchmark task */
+static BUS_COMMS_BenchRequest_t g_bench_run;
+static uint32                   g_bench_received;
+static int64                    g_bench_last_reply_usec;
+static uint32                   g_bench_rtt[BUS_COMMS_BENCH_MAX_PACKETS];
+static uint8                    g_bench_seen[BUS_COMMS_BENCH_MAX_PACKETS / 8];
+static BUS_COMMS_BenchTlm_t     g_bench_tlm;
+
+static int64 BUS_COMMS_BenchNowUsec(void)
+{
+    OS_time_t now;
+
+    OS_GetLocalTime(&now);
+    return OS_TimeGetTotalMicroseconds(now);
+}
+
+static int BUS_COMMS_BenchCompare(const void *a, const void *b)
+{
+    uint32 x = *(const uint32 *)a;
+    uint32 y = *(const uint32 *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* Echo requests back to their sender; record replies to our own run */
+static void BUS_COMMS_BenchDispatch(csp_packet_t *packet, bool measuring)
+{
+    uint32 seq;
+    int64  now;
+
+    if (packet->length < BUS_COMMS_BENCH_HDR_LEN)
+    {
+        csp_buffer_free(packet);
+        return;
+    }
+
+    if (packet->data[0] == BUS_COMMS_BENCH_PKT_REQUEST)
+    {
+        /* The received buffer goes straight back out; the TX queue owns it from here */
+        packet->data[0] = BUS_COMMS_BENCH_PKT_REPLY;
+        BUS_COMMS_TxqPush(CSP_PRIO_NORM, (uint8_t)packet->id.src, g_bench_port, BUS_COMMS_PORT_MODE_DGRAM, packet);
+        return;
+    }
+
+    seq = BUS_COMMS_Get32(&packet->data[4]);
+
+    if (measuring && packet->data[0] == BUS_COMMS_BENCH_PKT_REPLY &&
+        BUS_COMMS_Get16(&packet->data[2]) == g_bench_run_id && seq < g_bench_run.count &&
+        (g_bench_seen[seq / 8] & (1u << (seq % 8))) == 0)
+    {
+        now = BUS_COMMS_BenchNowUsec();
+
+        g_bench_seen[seq / 8] |= (uint8)(1u << (seq % 8));
+        g_bench_rtt[g_bench_received++] = (uint32)(now - (int64)BUS_COMMS_Get64(&packet->data[8]));
+        g_bench_last_reply_usec         = now;
+    }
+
+    csp_buffer_free(packet);
+}
+
+/* Handle everything already queued on the socket, waiting up to timeout_ms for the first */
+static void BUS_COMMS_BenchPoll(csp_socket_t *sock, uint32 timeout_ms, bool measuring)
+{
+    csp_packet_t *packet = csp_recvfrom(sock, timeout_ms);
+
+    while (packet != NULL)
+    {
+        BUS_COMMS_BenchDispatch(packet, measuring);
+        packet = csp_recvfrom(sock, 0);
+    }
+}
+
+static bool BUS_COMMS_BenchSendOne(uint32 seq)
+{
+    uint8_t       dest   = g_bench_run.dests[seq % g_bench_run.ndests];
+    csp_packet_t *packet = BUS_COMMS_BufGet(g_bench_run.len, 0);
+
+    if (packet == NULL)
+    {
+        return false;
+    }
+
+    memset(packet->data, 0, g_bench_run.len);
+    packet->data[0] = BUS_COMMS_BENCH_PKT_REQUEST;
+    BUS_COMMS_Put16(&packet->data[2], g_bench_run_id);
+    BUS_COMMS_Put32(&packet->data[4], seq);
+    BUS_COMMS_Put64(&packet->data[8], (uint64)BUS_COMMS_BenchNowUsec());
+    packet->length = g_bench_run.len;
+
+    return BUS_COMMS_TxqPushWait(CSP_PRIO_NORM, dest, g_bench_port, BUS_COMMS_PORT_MODE_DGRAM, packet,
+                                 BUS_COMMS_BENCH_QUEUE_WAIT_MSEC) == 0;
+}
+
+static void BUS_COMMS_BenchReport(uint32 sent, uint32 failed, int64 start_usec)
+{
+    int64 elapsed = ((g_bench_received > 0) ? g_bench_last_reply_usec : BUS_COMMS_BenchNowUsec()) - start_usec;
+
+    if (elapsed <= 0)
+    {
+        elapsed = 1;
+    }
+
+    qsort(g_bench_rtt, g_bench_received, sizeof(g_bench_rtt[0]), BUS_COMMS_BenchCompare);
+
+    memset(&g_bench_tlm.Payload, 0, sizeof(g_bench_tlm.Payload));
+    g_bench_tlm.Payload.RunId         = g_bench_run_id;
+    g_bench_tlm.Payload.PayloadLen    = g_bench_run.len;
+    g_bench_tlm.Payload.RateHz        = g_bench_run.rate;
+    g_bench_tlm.Payload.DestCount     = g_bench_run.ndests;
+    g_bench_tlm.Payload.Sent          = sent;
+    g_bench_tlm.Payload.SendFailed    = failed;
+    g_bench_tlm.Payload.Received      = g_bench_received;
+    g_bench_tlm.Payload.Dropped       = sent - g_bench_received;
+    g_bench_tlm.Payload.ElapsedMsec   = (uint32)(elapsed / 1000);
+    g_bench_tlm.Payload.PacketsPerSec = (uint32)(((uint64)g_bench_received * 1000000) / (uint64)elapsed);
+
+    if (g_bench_received > 0)
+    {
+        g_bench_tlm.Payload.LatP50Usec = g_bench_rtt[((g_bench_received - 1) * 50) / 100];
+        g_bench_tlm.Payload.LatP99Usec = g_bench_rtt[((g_bench_received - 1) * 99) / 100];
+        g_bench_tlm.Payload.LatMaxUsec = g_bench_rtt[g_bench_received - 1];
+    }
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(g_bench_tlm.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(g_bench_tlm.TelemetryHeader), true);
+
+    /* Fixed key=value layout, parsed by tools/bus_comms_bench.py */
+    CFE_EVS_SendEvent(BUS_COMMS_BENCH_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "BENCH run=%u len=%u rate=%lu dests=%u sent=%lu fail=%lu recv=%lu drop=%lu pps=%lu "
+                      "p50=%lu p99=%lu max=%lu",
+                      (unsigned)g_bench_run_id, (unsigned)g_bench_run.len, (unsigned long)g_bench_run.rate,
+                      (unsigned)g_bench_run.ndests, (unsigned long)sent, (unsigned long)failed,
+                      (unsigned long)g_bench_received, (unsigned long)g_bench_tlm.Payload.Dropped,
+                      (unsigned long)g_bench_tlm.Payload.PacketsPerSec, (unsigned long)g_bench_tlm.Payload.LatP50Usec,
+                      (unsigned long)g_bench_tlm.Payload.LatP99Usec, (unsigned long)g_bench_tlm.Payload.LatMaxUsec);
+}
+
+static void BUS_COMMS_BenchRun(csp_socket_t *sock)
+{
+    uint32 seq;
+    uint32 sent   = 0;
+    uint32 failed = 0;
+    int64  start_usec;
+    int64  due_usec;
+    int64  now_usec;
+
+    g_bench_run_id++;
+    g_bench_received        = 0;
+    g_bench_last_reply_usec = 0;
+    memset(g_bench_seen, 0, sizeof(g_bench_seen));
+
+    start_usec = BUS_COMMS_BenchNowUsec();
+
+    // A stop cuts the run short; what was measured so far is still reported
+    for (seq = 0; seq < g_bench_run.count && BUS_COMMS_Running(); ++seq)
+    {
+        /* Pace to the requested rate, serving replies while waiting; without a rate just drain */
+        if (g_bench_run.rate != 0)
+        {
+            due_usec = start_usec + ((int64)seq * 1000000) / g_bench_run.rate;
+            while ((now_usec = BUS_COMMS_BenchNowUsec()) + 1000 <= due_usec)
+            {
+                BUS_COMMS_BenchPoll(sock, (uint32)((due_usec - now_usec) / 1000), true);
+            }
+        }
+        else
+        {
+            BUS_COMMS_BenchPoll(sock, 0, true);
+        }
+
+        if (BUS_COMMS_BenchSendOne(seq))
+        {
+            sent++;
+        }
+        else
+        {
+            failed++;
+        }
+    }
+
+    due_usec = BUS_COMMS_BenchNowUsec() + (int64)BUS_COMMS_BENCH_DRAIN_MSEC * 1000;
+    while (g_bench_received < sent && BUS_COMMS_Running() && (now_usec = BUS_COMMS_BenchNowUsec()) < due_usec)
+    {
+        BUS_COMMS_BenchPoll(sock, (uint32)((due_usec - now_usec + 999) / 1000), true);
+    }
+
+    BUS_COMMS_BenchReport(sent, failed, start_usec);
+}
+
+int32 BUS_COMMS_BenchInit(uint8_t port)
+{
+    memset(&g_bench_req, 0, sizeof(g_bench_req));
+    g_bench_port = port;
+
+    CFE_MSG_Init(CFE_MSG_PTR(g_bench_tlm.TelemetryHeader), CFE_SB_ValueToMsgId(BUS_COMMS_BENCH_TLM_MID),
+                 sizeof(g_bench_tlm));
+
+    return OS_MutSemCreate(&g_bench_mutex, "BC_BENCH_MUT", 0);
+}
+
+int32 BUS_COMMS_BenchRequest(uint16 Count, uint16 PayloadLen, uint32 RateHz, uint8 DestCount, const uint8 *Dests)
+{
+    int32 status = CFE_SUCCESS;
+
+    OS_MutSemTake(g_bench_mutex);
+
+    if (g_bench_req.pending || g_bench_req.running)
+    {
+        status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+    else
+    {
+        g_bench_req.pending = true;
+        g_bench_req.count   = Count;
+        g_bench_req.len     = PayloadLen;
+        g_bench_req.rate    = RateHz;
+        g_bench_req.ndests  = DestCount;
+        memcpy(g_bench_req.dests, Dests, DestCount);
+    }
+
+    OS_MutSemGive(g_bench_mutex);
+
+    return status;
+}
+
+void BUS_COMMS_BenchTask(void)
+{
+    csp_socket_t sock = {.opts = CSP_SO_CONN_LESS};
+    bool         start;
+
+    if (g_bench_port == 0 || csp_bind(&sock, g_bench_port) != CSP_ERR_NONE)
+    {
+        CFE_ES_WriteToSysLog("BUS_COMMS: benchmark disabled (port %u)\n", (unsigned)g_bench_port);
+        BUS_COMMS_ChildExit();
+        return;
+    }
+
+    while (BUS_COMMS_Running())
+    {
+        OS_MutSemTake(g_bench_mutex);
+        start = g_bench_req.pending;
+        if (start)
+        {
+            g_bench_run         = g_bench_req;
+            g_bench_req.pending = false;
+            g_bench_req.running = true;
+        }
+        OS_MutSemGive(g_bench_mutex);
+
+        if (start)
+        {
+            BUS_COMMS_BenchRun(&sock);
+
+            OS_MutSemTake(g_bench_mutex);
+            g_bench_req.running = false;
+            OS_MutSemGive(g_bench_mutex);
+        }
+        else
+        {
+            BUS_COMMS_BenchPoll(&sock, BUS_COMMS_BENCH_IDLE_MSEC, false);
+        }
+    }
+    BUS_COMMS_ChildExit();
+}
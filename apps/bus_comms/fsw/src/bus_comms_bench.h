@@ -0,0 +1,33 @@
+/************************************************************************
+ * Bus Communications App - throughput/latency benchmark
+ ************************************************************************/
+#ifndef BUS_COMMS_BENCH_H
+#define BUS_COMMS_BENCH_H
+
+#include "cfe.h"
+
+#include <stdint.h>
+
+/*
+ * Every node with a BenchPort echoes benchmark requests straight back to
+ * the sender.  A BENCH command makes this node send a paced burst of
+ * timestamped requests round-robin over up to BUS_COMMS_BENCH_MAX_DESTS
+ * nodes (its own address goes through the CSP loopback interface), match
+ * the echoes, and publish packets/s, drops and round-trip percentiles in
+ * BUS_COMMS_BenchTlm_t plus a one-line BUS_COMMS_BENCH_INF_EID summary.
+ * tools/bus_comms_bench.py drives sweeps of these runs.
+ */
+#define BUS_COMMS_BENCH_MAX_PACKETS     4096
+#define BUS_COMMS_BENCH_HDR_LEN         16   /* type, spare, run(2), seq(4), send time in usec(8) */
+#define BUS_COMMS_BENCH_DRAIN_MSEC      1000 /* wait for late replies after the last send */
+#define BUS_COMMS_BENCH_QUEUE_WAIT_MSEC 100
+
+int32 BUS_COMMS_BenchInit(uint8_t port);
+
+/* Start a run on the benchmark task; fails while one is pending or running */
+int32 BUS_COMMS_BenchRequest(uint16 Count, uint16 PayloadLen, uint32 RateHz, uint8 DestCount, const uint8 *Dests);
+
+/* Child task body: owns the BenchPort socket */
+void BUS_COMMS_BenchTask(void);
+
+#endif /* BUS_COMMS_BENCH_H */
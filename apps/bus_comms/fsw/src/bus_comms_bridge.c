@@ -0,0 +1,274 @@
+/************************************************************************
+ * Bus Communications App - SB/CSP bridge
+ ************************************************************************/
+
+#include "bus_comms_app.h"
+#include "bus_comms_bridge.h"
+#include "bus_comms_buf.h"
+#include "bus_comms_txq.h"
+#include "bus_comms_frag.h"
+
+#include "bus_comms_event.h"
+#include "bus_comms_events.h"
+
+#include <string.h>
+
+static BUS_COMMS_SourcePipeMapEntry_t g_source_pipe_map[BUS_COMMS_MAX_SOURCE_MAPPINGS];
+static CFE_SB_PipeId_t                g_bridge_pipe = CFE_SB_INVALID_PIPE;
+
+/* Ingest map indexed by CSP port, NULL for ports that are not published */
+static const BUS_COMMS_IngestMapEntry_t *g_ingest_by_port[BUS_COMMS_CSP_PORT_COUNT];
+
+static void BUS_COMMS_BridgeForward(const CFE_SB_Buffer_t *SBBufPtr)
+{
+    CFE_SB_MsgId_t                        MsgId = CFE_SB_INVALID_MSG_ID;
+    size_t                                size  = 0;
+    const BUS_COMMS_SourcePipeMapEntry_t *entry;
+    csp_packet_t                         *packet;
+
+    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgId);
+    CFE_MSG_GetSize(&SBBufPtr->Msg, &size);
+
+    entry = BUS_COMMS_SourcePipeMapFind(MsgId);
+    if (entry != NULL && entry->segmented)
+    {
+        if (BUS_COMMS_FragSend(entry->prio, entry->dest, entry->port, entry->mode, SBBufPtr, size) == 0)
+        {
+            BUS_COMMS_STAT_INC(BridgeForwarded);
+        }
+        else
+        {
+            BUS_COMMS_STAT_INC(BridgeDropped);
+        }
+        return;
+    }
+
+    if (entry == NULL || size == 0 || size > csp_buffer_data_size())
+    {
+        BUS_COMMS_STAT_INC(BridgeDropped);
+        return;
+    }
+
+    /* The SB message, headers included, becomes the CSP payload: one copy
+     * straight into the CSP buffer and no command envelope to decode */
+    packet = BUS_COMMS_BufGet(size, 0);
+    if (packet == NULL)
+    {
+        BUS_COMMS_STAT_INC(BridgeDropped);
+        return;
+    }
+
+    memcpy(packet->data, SBBufPtr, size);
+    packet->length = (uint16_t)size;
+
+    if (BUS_COMMS_TxqPush(entry->prio, entry->dest, entry->port, entry->mode, packet) == 0)
+    {
+        BUS_COMMS_STAT_INC(BridgeForwarded);
+    }
+    else
+    {
+        BUS_COMMS_STAT_INC(BridgeDropped);
+    }
+}
+
+int32 BUS_COMMS_BridgeInit(const BUS_COMMS_Table_t *TblPtr, uint8_t peer_addr)
+{
+    int32 status;
+
+    memset(g_source_pipe_map, 0, sizeof(g_source_pipe_map));
+    memset(g_ingest_by_port, 0, sizeof(g_ingest_by_port));
+
+    for (size_t i = 0; i < BUS_COMMS_MAX_INGEST_MAPPINGS; ++i)
+    {
+        if (TblPtr->IngestMap[i].InUse && TblPtr->IngestMap[i].port < BUS_COMMS_CSP_PORT_COUNT)
+        {
+            g_ingest_by_port[TblPtr->IngestMap[i].port] = &TblPtr->IngestMap[i];
+        }
+    }
+
+    status = CFE_SB_CreatePipe(&g_bridge_pipe, TblPtr->BridgePipeDepth, "BUS_COMMS_BRIDGE");
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("BUS_COMMS: Error creating bridge pipe, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    for (size_t i = 0; i < BUS_COMMS_MAX_SOURCE_MAPPINGS; ++i)
+    {
+        if (!TblPtr->SourceMap[i].InUse)
+        {
+            continue;
+        }
+
+        g_source_pipe_map[i] = TblPtr->SourceMap[i];
+        if (g_source_pipe_map[i].dest == BUS_COMMS_ADDR_PEER)
+        {
+            g_source_pipe_map[i].dest = peer_addr;
+        }
+
+        status = CFE_SB_Subscribe(g_source_pipe_map[i].SourceMsgId, g_bridge_pipe);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("BUS_COMMS: Error subscribing bridge MID 0x%x, RC = 0x%08lX\n",
+                                 (unsigned int)CFE_SB_MsgIdToValue(g_source_pipe_map[i].SourceMsgId),
+                                 (unsigned long)status);
+            return status;
+        }
+    }
+
+    return CFE_SUCCESS;
+}
+
+void BUS_COMMS_BridgeProcess(int32 timeout_ms)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    int32            status;
+    uint32           count = 0;
+
+    status = CFE_SB_ReceiveBuffer(&SBBufPtr, g_bridge_pipe, timeout_ms);
+    while (status == CFE_SUCCESS)
+    {
+        BUS_COMMS_BridgeForward(SBBufPtr);
+
+        if (++count >= BUS_COMMS_BRIDGE_MAX_BURST)
+        {
+            break;
+        }
+
+        status = CFE_SB_ReceiveBuffer(&SBBufPtr, g_bridge_pipe, CFE_SB_POLL);
+    }
+
+    /* Keep the caller from spinning if the pipe itself is broken */
+    if (count == 0 && status != CFE_SB_TIME_OUT && status != CFE_SB_NO_MESSAGE)
+    {
+        OS_TaskDelay((uint32)timeout_ms);
+    }
+}
+
+const BUS_COMMS_SourcePipeMapEntry_t *BUS_COMMS_SourcePipeMapFind(CFE_SB_MsgId_t msg_id)
+{
+    for (size_t i = 0; i < BUS_COMMS_MAX_SOURCE_MAPPINGS; ++i)
+    {
+        if (g_source_pipe_map[i].InUse && CFE_SB_MsgId_Equal(g_source_pipe_map[i].SourceMsgId, msg_id))
+        {
+            return &g_source_pipe_map[i];
+        }
+    }
+
+    return NULL;
+}
+
+uint32 BUS_COMMS_BridgeBindIngestPorts(csp_socket_t *sock, uint8_t mode)
+{
+    uint32 count = 0;
+
+    for (uint8_t port = 0; port < BUS_COMMS_CSP_PORT_COUNT; ++port)
+    {
+        if (g_ingest_by_port[port] == NULL || g_ingest_by_port[port]->mode != mode)
+        {
+            continue;
+        }
+
+        if (csp_bind(sock, port) != CSP_ERR_NONE)
+        {
+            CFE_ES_WriteToSysLog("BUS_COMMS: csp_bind failed for ingest port %u\n", (unsigned)port);
+        }
+        else
+        {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+void BUS_COMMS_BridgeIngest(CFE_SB_Buffer_t **NextBufPtr, csp_packet_t *packet, uint8_t port)
+{
+    const BUS_COMMS_IngestMapEntry_t *entry = NULL;
+    CFE_SB_Buffer_t                  *BufPtr;
+    size_t                            size;
+    int32                             status;
+
+    if (port < BUS_COMMS_CSP_PORT_COUNT)
+    {
+        entry = g_ingest_by_port[port];
+    }
+
+    if (entry == NULL)
+    {
+        /* Not a published port (e.g. pings); the route table already counted it */
+        csp_buffer_free(packet);
+        return;
+    }
+
+    if (entry->segmented)
+    {
+        BUS_COMMS_FragReceive(entry, packet);
+        return;
+    }
+
+    /* Held across packets until a transmit succeeds, same as ci_lab */
+    if (*NextBufPtr == NULL)
+    {
+        *NextBufPtr = CFE_SB_AllocateMessageBuffer(BUS_COMMS_MAX_INGEST);
+        if (*NextBufPtr == NULL)
+        {
+            BUS_COMMS_STAT_INC(IngestErrors);
+            BUS_COMMS_ErrEvent(BUS_COMMS_INGEST_ALLOC_ERR_EID, "BUS_COMMS: ingest buffer allocation failed");
+            csp_buffer_free(packet);
+            return;
+        }
+    }
+
+    BufPtr = *NextBufPtr;
+
+    if (CFE_SB_IsValidMsgId(entry->MsgId))
+    {
+        /* Raw payload: wrap it in a telemetry header for the mapped MID */
+        size = sizeof(CFE_MSG_TelemetryHeader_t) + packet->length;
+        if (size > BUS_COMMS_MAX_INGEST)
+        {
+            BUS_COMMS_STAT_INC(IngestErrors);
+            csp_buffer_free(packet);
+            return;
+        }
+
+        CFE_MSG_Init(&BufPtr->Msg, entry->MsgId, size);
+        memcpy((uint8 *)BufPtr + sizeof(CFE_MSG_TelemetryHeader_t), packet->data, packet->length);
+        CFE_SB_TimeStampMsg(&BufPtr->Msg);
+    }
+    else
+    {
+        /* Complete SB message from the peer's bridge: the header must agree with the packet */
+        size = 0;
+        if (packet->length >= sizeof(CFE_MSG_Message_t) && packet->length <= BUS_COMMS_MAX_INGEST)
+        {
+            memcpy(BufPtr, packet->data, packet->length);
+            CFE_MSG_GetSize(&BufPtr->Msg, &size);
+        }
+
+        if (size == 0 || size != packet->length)
+        {
+            BUS_COMMS_STAT_INC(IngestErrors);
+            csp_buffer_free(packet);
+            return;
+        }
+    }
+
+    csp_buffer_free(packet);
+
+    status = CFE_SB_TransmitBuffer(BufPtr, false);
+    if (status == CFE_SUCCESS)
+    {
+        BUS_COMMS_STAT_INC(IngestPackets);
+
+        /* Set NULL so a new buffer will be obtained next time around */
+        *NextBufPtr = NULL;
+    }
+    else
+    {
+        BUS_COMMS_STAT_INC(IngestErrors);
+        BUS_COMMS_ErrEvent(BUS_COMMS_INGEST_SEND_ERR_EID, "BUS_COMMS: CFE_SB_TransmitBuffer() failed, status=%d",
+                           (int)status);
+    }
+}
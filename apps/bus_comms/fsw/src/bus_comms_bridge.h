@@ -0,0 +1,43 @@
+/************************************************************************
+ * Bus Communications App - SB/CSP bridge
+ ************************************************************************/
+#ifndef BUS_COMMS_BRIDGE_H
+#define BUS_COMMS_BRIDGE_H
+
+#include "cfe.h"
+
+#include "bus_comms_table.h"
+
+#include <csp/csp.h>
+
+
+/* Upper bound on messages forwarded per wakeup of the bridge task */
+#define BUS_COMMS_BRIDGE_MAX_BURST  16
+
+/* Size of each SB buffer used for CSP-to-SB ingest */
+#define BUS_COMMS_MAX_INGEST 512
+
+/* CSP ports are 6 bits wide */
+#define BUS_COMMS_CSP_PORT_COUNT 64
+
+/* Datagram receive: wait this long for the first packet, then drain up to
+ * BUS_COMMS_DGRAM_MAX_BURST more without blocking */
+#define BUS_COMMS_DGRAM_RX_TIMEOUT BUS_COMMS_STOP_POLL_MSEC
+#define BUS_COMMS_DGRAM_MAX_BURST  32
+
+int32 BUS_COMMS_BridgeInit(const BUS_COMMS_Table_t *TblPtr, uint8_t peer_addr);
+
+/* Pend up to 'timeout_ms' on the bridge pipe, then hand what arrived to the TX queue */
+void BUS_COMMS_BridgeProcess(int32 timeout_ms);
+
+const BUS_COMMS_SourcePipeMapEntry_t *BUS_COMMS_SourcePipeMapFind(CFE_SB_MsgId_t msg_id);
+
+/* Bind every ingest port configured for 'mode' to 'sock'; returns the count bound */
+uint32 BUS_COMMS_BridgeBindIngestPorts(csp_socket_t *sock, uint8_t mode);
+
+/* Publish a received CSP packet on the SB if its port is mapped.  Takes
+ * ownership of 'packet'.  'NextBufPtr' is the calling task's ingest buffer,
+ * kept across calls until a transmit succeeds. */
+void BUS_COMMS_BridgeIngest(CFE_SB_Buffer_t **NextBufPtr, csp_packet_t *packet, uint8_t port);
+
+#endif /* BUS_COMMS_BRIDGE_H */
@@ -0,0 +1,82 @@
+/************************************************************************
+ * Bus Communications App - CSP buffer accounting
+ ************************************************************************/
+
+#include "bus_comms_app.h"
+#include "bus_comms_buf.h"
+
+#include "osapi.h"
+
+static uint32 g_buf_limit = CSP_BUFFER_COUNT;
+
+/* Buffers in use across the whole pool, bus_comms' and libcsp's */
+static uint32 BUS_COMMS_BufSample(void)
+{
+    int    remaining = csp_buffer_remaining();
+    uint32 used      = 0;
+
+    if (remaining >= 0 && (uint32)remaining <= CSP_BUFFER_COUNT)
+    {
+        used = CSP_BUFFER_COUNT - (uint32)remaining;
+    }
+
+    BUS_COMMS_STAT_MAX(CspBufPeakUsed, used);
+
+    return used;
+}
+
+void BUS_COMMS_BufSetLimit(uint16 count)
+{
+    // Set by the main task on table load, read by every sender
+    __atomic_store_n(&g_buf_limit, (count == 0 || count > CSP_BUFFER_COUNT) ? CSP_BUFFER_COUNT : count,
+                     __ATOMIC_RELAXED);
+}
+
+csp_packet_t *BUS_COMMS_BufGet(size_t len, uint32 wait_ms)
+{
+    csp_packet_t *packet = NULL;
+    OS_time_t     start;
+    OS_time_t     now;
+
+    if (len <= csp_buffer_data_size())
+    {
+        OS_GetLocalTime(&start);
+        for (;;)
+        {
+            if (BUS_COMMS_BufSample() < __atomic_load_n(&g_buf_limit, __ATOMIC_RELAXED))
+            {
+                packet = csp_buffer_get(len);
+            }
+
+            if (packet != NULL)
+            {
+                break;
+            }
+
+            // A one-tick delay can sleep well past 1 ms, so bound the wait by the clock
+            OS_GetLocalTime(&now);
+            if ((uint32)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(now, start)) >= wait_ms)
+            {
+                break;
+            }
+
+            OS_TaskDelay(1);
+        }
+    }
+
+    if (packet == NULL)
+    {
+        BUS_COMMS_STAT_INC(CspBufAllocFails);
+    }
+
+    return packet;
+}
+
+void BUS_COMMS_BufReport(uint32 *total, uint32 *free_now, uint32 *peak)
+{
+    uint32 used = BUS_COMMS_BufSample();
+
+    *total    = CSP_BUFFER_COUNT;
+    *free_now = CSP_BUFFER_COUNT - used;
+    *peak     = BUS_COMMS_STAT_GET(CspBufPeakUsed);
+}
@@ -0,0 +1,35 @@
+/************************************************************************
+ * Bus Communications App - CSP buffer accounting
+ ************************************************************************/
+#ifndef BUS_COMMS_BUF_H
+#define BUS_COMMS_BUF_H
+
+#include "cfe.h"
+
+#include <stdint.h>
+
+#include <csp/csp.h>
+
+/*
+ * Every packet bus_comms builds comes from libcsp's buffer pool through
+ * BUS_COMMS_BufGet().  The pool holds CSP_BUFFER_COUNT buffers, sized when
+ * libcsp is built, and is shared with libcsp's own receive path.  Once the
+ * table's CspBufferCount buffers are in use, bus_comms allocations fail and
+ * the rest of the pool is left for reception, so a transmit backlog cannot
+ * starve it.  Pool use is sampled on
+ * every allocation and at HK, see BUS_COMMS_BufReport().
+ */
+
+/* Fail bus_comms allocations once 'count' buffers are in use across the
+ * pool; 0 allows the whole pool */
+void BUS_COMMS_BufSetLimit(uint16 count);
+
+/* Get a buffer for a 'len' byte payload, waiting up to 'wait_ms' for one
+ * to be freed.  Returns NULL, and counts an allocation failure, if none
+ * is available in time. */
+csp_packet_t *BUS_COMMS_BufGet(size_t len, uint32 wait_ms);
+
+/* Pool size, buffers free now and the most ever in use, for HK */
+void BUS_COMMS_BufReport(uint32 *total, uint32 *free_now, uint32 *peak);
+
+#endif /* BUS_COMMS_BUF_H */
@@ -0,0 +1,330 @@
+/************************************************************************
+ * Bus Communications App - configuration table
+ ************************************************************************/
+
+#include "bus_comms_app.h"
+#include "bus_comms_config.h"
+#include "bus_comms_events.h"
+#include "bus_comms_bridge.h"
+#include "bus_comms_buf.h"
+#include "bus_comms_iface.h"
+#include "bus_comms_sched.h"
+#include "bus_comms_txq.h"
+
+#include <string.h>
+
+static bool BUS_COMMS_ConfigPortValid(uint8_t port, uint8_t mode)
+{
+    return port < BUS_COMMS_CSP_PORT_COUNT &&
+           (mode == BUS_COMMS_PORT_MODE_CONN || mode == BUS_COMMS_PORT_MODE_DGRAM);
+}
+
+/* A loopback-only node talks to itself, so only there may the peer be the node */
+static bool BUS_COMMS_ConfigNodeValid(const BUS_COMMS_NodeMapEntry_t *node, bool loopback)
+{
+    return (node->MyAddr != node->PeerAddr || loopback) && node->MyAddr != BUS_COMMS_ADDR_PEER &&
+           node->PeerAddr != BUS_COMMS_ADDR_PEER;
+}
+
+static bool BUS_COMMS_ConfigIfaceValid(const BUS_COMMS_InterfaceEntry_t *e)
+{
+    if (e->Type == BUS_COMMS_IF_TYPE_LOOPBACK)
+    {
+        return !e->IsDefault;
+    }
+
+    return (e->Type == BUS_COMMS_IF_TYPE_CAN || e->Type == BUS_COMMS_IF_TYPE_ZMQ) &&
+           memchr(e->Device, 0, sizeof(e->Device)) != NULL && e->Device[0] != 0 &&
+           (e->Type != BUS_COMMS_IF_TYPE_CAN || e->Bitrate != 0);
+}
+
+/* Routes may only use opened CAN or ZMQ interfaces */
+static bool BUS_COMMS_ConfigIfaceRoutable(const BUS_COMMS_Table_t *Tbl, uint8_t index)
+{
+    return index < BUS_COMMS_MAX_INTERFACES && Tbl->Interfaces[index].InUse &&
+           Tbl->Interfaces[index].Type != BUS_COMMS_IF_TYPE_LOOPBACK;
+}
+
+int32 BUS_COMMS_ConfigInit(void)
+{
+    int32  status;
+    void  *TblPtr = NULL;
+
+    status = CFE_TBL_Register(&BUS_COMMS_AppData.TblHandle, BUS_COMMS_TABLE_NAME, sizeof(BUS_COMMS_Table_t),
+                              CFE_TBL_OPT_DEFAULT, BUS_COMMS_TblValidationFunc);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("BUS_COMMS: Error Registering Table, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    status = CFE_TBL_Load(BUS_COMMS_AppData.TblHandle, CFE_TBL_SRC_FILE, BUS_COMMS_TABLE_FILE);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("BUS_COMMS: Error Loading Table %s, RC = 0x%08lX\n", BUS_COMMS_TABLE_FILE,
+                             (unsigned long)status);
+        return status;
+    }
+
+    status = CFE_TBL_GetAddress(&TblPtr, BUS_COMMS_AppData.TblHandle);
+    if (status != CFE_SUCCESS && status != CFE_TBL_INFO_UPDATED)
+    {
+        CFE_ES_WriteToSysLog("BUS_COMMS: Error Getting Table Address, RC = 0x%08lX\n", (unsigned long)status);
+        return status;
+    }
+
+    /* Startup-only settings are read from this copy for the life of the app */
+    memcpy(&BUS_COMMS_AppData.Config, TblPtr, sizeof(BUS_COMMS_AppData.Config));
+
+    CFE_TBL_ReleaseAddress(BUS_COMMS_AppData.TblHandle);
+
+    return CFE_SUCCESS;
+}
+
+void BUS_COMMS_ConfigApply(const BUS_COMMS_Table_t *TblPtr, uint8_t peer_addr)
+{
+    uint8_t dest;
+
+    for (uint32 i = 0; i < 256; ++i)
+    {
+        BUS_COMMS_TxqSetRate((uint8_t)i, TblPtr->DefaultBytesPerSec, TblPtr->DefaultBurst);
+    }
+
+    for (size_t i = 0; i < BUS_COMMS_MAX_RATE_LIMITS; ++i)
+    {
+        if (TblPtr->RateLimits[i].InUse)
+        {
+            dest = TblPtr->RateLimits[i].dest;
+            if (dest == BUS_COMMS_ADDR_PEER)
+            {
+                dest = peer_addr;
+            }
+
+            BUS_COMMS_TxqSetRate(dest, TblPtr->RateLimits[i].BytesPerSec, TblPtr->RateLimits[i].Burst);
+        }
+    }
+
+    BUS_COMMS_TxqSetDepth(TblPtr->TxQueueDepth);
+    BUS_COMMS_TxqSetCmdBudget(TblPtr->CmdBudgetMsec);
+    BUS_COMMS_BufSetLimit(TblPtr->CspBufferCount);
+    BUS_COMMS_SchedLoad(TblPtr->Schedules, peer_addr);
+}
+
+void BUS_COMMS_ConfigManage(uint8_t peer_addr)
+{
+    void *TblPtr = NULL;
+    int32 status;
+
+    if (CFE_TBL_Manage(BUS_COMMS_AppData.TblHandle) != CFE_TBL_INFO_UPDATED)
+    {
+        return;
+    }
+
+    status = CFE_TBL_GetAddress(&TblPtr, BUS_COMMS_AppData.TblHandle);
+    if (status == CFE_SUCCESS || status == CFE_TBL_INFO_UPDATED)
+    {
+        BUS_COMMS_ConfigApply(TblPtr, peer_addr);
+        CFE_TBL_ReleaseAddress(BUS_COMMS_AppData.TblHandle);
+
+        CFE_EVS_SendEvent(BUS_COMMS_TBL_UPDATE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "BUS_COMMS: table update applied (rate limits, schedules, TX queue depth)");
+    }
+}
+
+int32 BUS_COMMS_TblValidationFunc(void *TblData)
+{
+    const BUS_COMMS_Table_t *Tbl    = (const BUS_COMMS_Table_t *)TblData;
+    const char              *reason = NULL;
+    size_t                   index  = 0;
+    size_t                   bad    = 0;
+    bool                     ports_seen[BUS_COMMS_CSP_PORT_COUNT] = {false};
+    bool                     dests_seen[256]                      = {false};
+    uint32                   if_count                             = 0;
+    uint32                   if_external                          = 0;
+    uint32                   if_default                           = 0;
+    uint32                   if_zmq                               = 0;
+    bool                     loopback                             = BUS_COMMS_IfaceLoopbackOnly(Tbl);
+
+    if (Tbl->CspPort >= BUS_COMMS_CSP_PORT_COUNT)
+    {
+        reason = "CspPort";
+    }
+    else if (Tbl->XferPort >= BUS_COMMS_CSP_PORT_COUNT || (Tbl->XferPort != 0 && Tbl->XferPort == Tbl->CspPort))
+    {
+        reason = "XferPort";
+    }
+    else if (Tbl->BenchPort >= BUS_COMMS_CSP_PORT_COUNT ||
+             (Tbl->BenchPort != 0 && (Tbl->BenchPort == Tbl->CspPort || Tbl->BenchPort == Tbl->XferPort)))
+    {
+        reason = "BenchPort";
+    }
+    else if (Tbl->HbPort >= BUS_COMMS_CSP_PORT_COUNT ||
+             (Tbl->HbPort != 0 && (Tbl->HbPort == Tbl->CspPort || Tbl->HbPort == Tbl->XferPort ||
+                                   Tbl->HbPort == Tbl->BenchPort)))
+    {
+        reason = "HbPort";
+    }
+    else if (Tbl->HbPort != 0 && (Tbl->HbPeriodMsec < BUS_COMMS_SCHED_MIN_PERIOD || Tbl->HbMissLimit == 0))
+    {
+        reason = "HbPeriodMsec/HbMissLimit";
+    }
+    else if (Tbl->BridgePipeDepth == 0 || Tbl->BridgePipeDepth > OS_QUEUE_MAX_DEPTH)
+    {
+        reason = "BridgePipeDepth";
+    }
+    else if (Tbl->TxQueueDepth == 0 || Tbl->TxQueueDepth > BUS_COMMS_TXQ_LANE_DEPTH)
+    {
+        reason = "TxQueueDepth";
+    }
+    else if (Tbl->CspBufferCount > CSP_BUFFER_COUNT)
+    {
+        reason = "CspBufferCount";
+    }
+    else if (!BUS_COMMS_ConfigNodeValid(&Tbl->DefaultNode, loopback))
+    {
+        reason = "DefaultNode";
+    }
+    else if (Tbl->DefaultBytesPerSec != 0 && Tbl->DefaultBurst == 0)
+    {
+        reason = "DefaultBurst";
+    }
+
+    /* Any number of CAN buses with distinct devices, at most one ZMQ hub
+     * (libcsp names it ZMQHUB), and one default unless the node is loopback only */
+    for (index = 0; reason == NULL && index < BUS_COMMS_MAX_INTERFACES; ++index)
+    {
+        const BUS_COMMS_InterfaceEntry_t *e = &Tbl->Interfaces[index];
+
+        if (!e->InUse)
+        {
+            continue;
+        }
+
+        if (!BUS_COMMS_ConfigIfaceValid(e))
+        {
+            reason = "Interfaces";
+            bad    = index;
+        }
+
+        for (size_t j = 0; reason == NULL && j < index; ++j)
+        {
+            if (Tbl->Interfaces[j].InUse && Tbl->Interfaces[j].Type == BUS_COMMS_IF_TYPE_CAN &&
+                e->Type == BUS_COMMS_IF_TYPE_CAN && strcmp(Tbl->Interfaces[j].Device, e->Device) == 0)
+            {
+                reason = "Interfaces";
+                bad    = index;
+            }
+        }
+
+        if_count++;
+        if_external += (e->Type != BUS_COMMS_IF_TYPE_LOOPBACK);
+        if_default += e->IsDefault;
+        if_zmq += (e->Type == BUS_COMMS_IF_TYPE_ZMQ);
+    }
+
+    if (reason == NULL && (if_count == 0 || if_zmq > 1 || if_default != (if_external != 0 ? 1u : 0u)))
+    {
+        reason = "Interfaces";
+    }
+
+    for (index = 0; reason == NULL && index < BUS_COMMS_MAX_IF_ROUTES; ++index)
+    {
+        const BUS_COMMS_IfRouteEntry_t *e = &Tbl->InterfaceRoutes[index];
+
+        if (!e->InUse)
+        {
+            continue;
+        }
+
+        if (dests_seen[e->dest] || !BUS_COMMS_ConfigIfaceRoutable(Tbl, e->Primary) ||
+            (e->Backup != BUS_COMMS_IF_NONE &&
+             (e->Backup == e->Primary || !BUS_COMMS_ConfigIfaceRoutable(Tbl, e->Backup))))
+        {
+            reason = "InterfaceRoutes";
+            bad    = index;
+        }
+        else
+        {
+            dests_seen[e->dest] = true;
+        }
+    }
+
+    for (index = 0; reason == NULL && index < BUS_COMMS_MAX_NODE_MAPPINGS; ++index)
+    {
+        if (Tbl->NodeMap[index].InUse && !BUS_COMMS_ConfigNodeValid(&Tbl->NodeMap[index], loopback))
+        {
+            reason = "NodeMap";
+            bad    = index;
+        }
+    }
+
+    for (index = 0; reason == NULL && index < BUS_COMMS_MAX_RATE_LIMITS; ++index)
+    {
+        const BUS_COMMS_RateLimitEntry_t *e = &Tbl->RateLimits[index];
+
+        if (e->InUse && e->BytesPerSec != 0 && e->Burst == 0)
+        {
+            reason = "RateLimits";
+            bad    = index;
+        }
+    }
+
+    for (index = 0; reason == NULL && index < BUS_COMMS_MAX_SCHEDULES; ++index)
+    {
+        const BUS_COMMS_ScheduleEntry_t *e = &Tbl->Schedules[index];
+
+        if (e->InUse && (e->PeriodMsec < BUS_COMMS_SCHED_MIN_PERIOD || e->len == 0 ||
+                         e->len > BUS_COMMS_SCHED_MAX_DATA || e->prio > CSP_PRIO_LOW ||
+                         !BUS_COMMS_ConfigPortValid(e->port, BUS_COMMS_PORT_MODE_CONN)))
+        {
+            reason = "Schedules";
+            bad    = index;
+        }
+    }
+
+    for (index = 0; reason == NULL && index < BUS_COMMS_MAX_SOURCE_MAPPINGS; ++index)
+    {
+        const BUS_COMMS_SourcePipeMapEntry_t *e = &Tbl->SourceMap[index];
+
+        if (e->InUse && (!CFE_SB_IsValidMsgId(e->SourceMsgId) || e->prio > CSP_PRIO_LOW ||
+                         !BUS_COMMS_ConfigPortValid(e->port, e->mode)))
+        {
+            reason = "SourceMap";
+            bad    = index;
+        }
+    }
+
+    for (index = 0; reason == NULL && index < BUS_COMMS_MAX_INGEST_MAPPINGS; ++index)
+    {
+        const BUS_COMMS_IngestMapEntry_t *e = &Tbl->IngestMap[index];
+
+        if (!e->InUse)
+        {
+            continue;
+        }
+
+        /* One SB mapping per port; the app's own service ports cannot be remapped */
+        if (!BUS_COMMS_ConfigPortValid(e->port, e->mode) || ports_seen[e->port] || e->port == Tbl->CspPort ||
+            (Tbl->XferPort != 0 && e->port == Tbl->XferPort) ||
+            (Tbl->BenchPort != 0 && e->port == Tbl->BenchPort) ||
+            (Tbl->HbPort != 0 && e->port == Tbl->HbPort))
+        {
+            reason = "IngestMap";
+            bad    = index;
+        }
+        else
+        {
+            ports_seen[e->port] = true;
+        }
+    }
+
+    if (reason != NULL)
+    {
+        CFE_EVS_SendEvent(BUS_COMMS_TBL_VALIDATION_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "BUS_COMMS: table validation failed: %s (entry %lu)", reason,
+                          (unsigned long)bad);
+        return BUS_COMMS_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+
+    return CFE_SUCCESS;
+}
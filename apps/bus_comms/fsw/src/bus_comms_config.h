@@ -0,0 +1,27 @@
+/************************************************************************
+ * Bus Communications App - configuration table
+ ************************************************************************/
+#ifndef BUS_COMMS_CONFIG_H
+#define BUS_COMMS_CONFIG_H
+
+#include "cfe.h"
+
+#include <stdint.h>
+
+#include "bus_comms_table.h"
+
+/* Register and load BUS_COMMS_TABLE_NAME and take the startup snapshot
+ * in BUS_COMMS_AppData.Config */
+int32 BUS_COMMS_ConfigInit(void);
+
+/* Push the reloadable settings (rate limits, schedules, queue depth,
+ * command budget, buffer limit) to
+ * the modules that use them */
+void BUS_COMMS_ConfigApply(const BUS_COMMS_Table_t *TblPtr, uint8_t peer_addr);
+
+/* Let CFE_TBL validate and activate pending loads, then apply them */
+void BUS_COMMS_ConfigManage(uint8_t peer_addr);
+
+int32 BUS_COMMS_TblValidationFunc(void *TblData);
+
+#endif /* BUS_COMMS_CONFIG_H */
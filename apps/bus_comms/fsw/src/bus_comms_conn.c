@@ -0,0 +1,141 @@
+/************************************************************************
+ * Bus Communications App - CSP connection cache
+ ************************************************************************/
+
+#include "bus_comms_app.h"
+#include "bus_comms_conn.h"
+#include "bus_comms_event.h"
+#include "bus_comms_events.h"
+
+#include <string.h>
+
+#include "osapi.h"
+
+typedef struct
+{
+    csp_conn_t *conn;
+    uint8_t     dest;
+    uint8_t     port;
+    uint8_t     prio;
+    OS_time_t   last_used;
+} BUS_COMMS_ConnEntry_t;
+
+/* Owned by the TX task */
+static BUS_COMMS_ConnEntry_t g_conn_cache[BUS_COMMS_CONN_CACHE_SIZE];
+
+static void BUS_COMMS_ConnEntryClose(BUS_COMMS_ConnEntry_t *entry)
+{
+    if (entry->conn != NULL)
+    {
+        csp_close(entry->conn);
+        entry->conn = NULL;
+        BUS_COMMS_STAT_INC(ConnCacheEvictions);
+    }
+}
+
+static void BUS_COMMS_ConnCacheSweepAt(OS_time_t now)
+{
+    for (size_t i = 0; i < BUS_COMMS_CONN_CACHE_SIZE; ++i)
+    {
+        if (g_conn_cache[i].conn != NULL &&
+            OS_TimeGetTotalMilliseconds(OS_TimeSubtract(now, g_conn_cache[i].last_used)) >
+                BUS_COMMS_CONN_IDLE_TIMEOUT_MSEC)
+        {
+            BUS_COMMS_ConnEntryClose(&g_conn_cache[i]);
+        }
+    }
+}
+
+void BUS_COMMS_ConnCacheInit(void)
+{
+    memset(g_conn_cache, 0, sizeof(g_conn_cache));
+}
+
+csp_conn_t *BUS_COMMS_ConnGet(uint8_t prio, uint8_t dest, uint8_t port, uint32 timeout_ms)
+{
+    BUS_COMMS_ConnEntry_t *entry  = NULL;
+    BUS_COMMS_ConnEntry_t *victim = NULL;
+    OS_time_t              now;
+
+    OS_GetLocalTime(&now);
+    BUS_COMMS_ConnCacheSweepAt(now);
+
+    for (size_t i = 0; i < BUS_COMMS_CONN_CACHE_SIZE; ++i)
+    {
+        BUS_COMMS_ConnEntry_t *e = &g_conn_cache[i];
+
+        if (e->conn != NULL && e->dest == dest && e->port == port && e->prio == prio)
+        {
+            entry = e;
+            break;
+        }
+
+        /* Prefer a free slot, otherwise the least recently used one */
+        if (victim == NULL || (victim->conn != NULL && e->conn == NULL))
+        {
+            victim = e;
+        }
+        else if (victim->conn != NULL &&
+                 OS_TimeGetTotalMilliseconds(OS_TimeSubtract(e->last_used, victim->last_used)) < 0)
+        {
+            victim = e;
+        }
+    }
+
+    if (entry != NULL)
+    {
+        BUS_COMMS_STAT_INC(ConnCacheHits);
+    }
+    else
+    {
+        BUS_COMMS_STAT_INC(ConnCacheMisses);
+        BUS_COMMS_ConnEntryClose(victim);
+
+        CFE_ES_PerfLogEntry(BUS_COMMS_CONNECT_PERF_ID);
+        victim->conn = csp_connect(prio, dest, port, timeout_ms, CSP_O_NONE);
+        CFE_ES_PerfLogExit(BUS_COMMS_CONNECT_PERF_ID);
+
+        if (victim->conn == NULL)
+        {
+            BUS_COMMS_ErrEvent(BUS_COMMS_CONN_ERR_EID, "BUS_COMMS: csp_connect to %u:%u failed", (unsigned)dest,
+                               (unsigned)port);
+            return NULL;
+        }
+
+        victim->dest = dest;
+        victim->port = port;
+        victim->prio = prio;
+        entry        = victim;
+    }
+
+    entry->last_used = now;
+
+    return entry->conn;
+}
+
+void BUS_COMMS_ConnCacheInvalidate(uint8_t dest)
+{
+    for (size_t i = 0; i < BUS_COMMS_CONN_CACHE_SIZE; ++i)
+    {
+        if (g_conn_cache[i].conn != NULL && g_conn_cache[i].dest == dest)
+        {
+            BUS_COMMS_ConnEntryClose(&g_conn_cache[i]);
+        }
+    }
+}
+
+void BUS_COMMS_ConnCacheSweep(void)
+{
+    OS_time_t now;
+
+    OS_GetLocalTime(&now);
+    BUS_COMMS_ConnCacheSweepAt(now);
+}
+
+void BUS_COMMS_ConnCacheClose(void)
+{
+    for (size_t i = 0; i < BUS_COMMS_CONN_CACHE_SIZE; ++i)
+    {
+        BUS_COMMS_ConnEntryClose(&g_conn_cache[i]);
+    }
+}
@@ -0,0 +1,53 @@
+/************************************************************************
+ * Bus Communications App - CSP connection cache
+ ************************************************************************/
+#ifndef BUS_COMMS_CONN_H
+#define BUS_COMMS_CONN_H
+
+#include "cfe.h"
+
+#include <stdint.h>
+
+#include <csp/csp.h>
+
+/*
+ * Open connections are kept per (dest, port, priority) so repeated sends to
+ * the same node skip csp_connect/csp_close.  Entries idle for longer than
+ * BUS_COMMS_CONN_IDLE_TIMEOUT_MSEC are closed; when the cache is full the
+ * least recently used entry is evicted to make room.  The cache takes at
+ * most half of libcsp's connection pool, leaving the rest for connections
+ * accepted from other nodes.
+ *
+ * The cache belongs to the TX task, the only task that sends: every call
+ * below except Init and Close (made before the child tasks start and after
+ * they exit) comes from it, so the cache keeps no lock and a slow connect
+ * or send never holds up another task.
+ */
+#define BUS_COMMS_CONN_CACHE_SIZE        (CSP_CONN_MAX / 2)
+#define BUS_COMMS_CONN_IDLE_TIMEOUT_MSEC 10000
+#define BUS_COMMS_CONN_CONNECT_TIMEOUT   1000 /* for sends without a budget of their own */
+
+#if BUS_COMMS_CONN_CACHE_SIZE < 1 || BUS_COMMS_CONN_CACHE_SIZE >= CSP_CONN_MAX
+#error BUS_COMMS_CONN_CACHE_SIZE must leave libcsp connections free for inbound traffic (raise CSP_CONN_MAX)
+#endif
+
+void BUS_COMMS_ConnCacheInit(void);
+
+/* Look up the connection for prio:dest:port, connecting on a miss and
+ * waiting at most 'timeout_ms'.  The connection stays valid until the
+ * next call into the cache. */
+csp_conn_t *BUS_COMMS_ConnGet(uint8_t prio, uint8_t dest, uint8_t port, uint32 timeout_ms);
+
+/* Drop every cached connection to 'dest' so the next send reconnects;
+ * called when a connect to it fails, when the heartbeat declares it dead
+ * and when its route moves to another interface */
+void BUS_COMMS_ConnCacheInvalidate(uint8_t dest);
+
+/* Close connections that have been idle past the timeout; the TX task
+ * calls this on each wakeup so idle connections close on a quiet bus */
+void BUS_COMMS_ConnCacheSweep(void);
+
+/* Close every cached connection, at app shutdown */
+void BUS_COMMS_ConnCacheClose(void);
+
+#endif /* BUS_COMMS_CONN_H */
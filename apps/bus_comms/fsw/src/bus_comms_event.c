@@ -0,0 +1,75 @@
+/************************************************************************
+ * Bus Communications App - rate-limited error events
+ ************************************************************************/
+
+#include "bus_comms_app.h"
+#include "bus_comms_event.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "osapi.h"
+
+typedef struct
+{
+    bool      sent;
+    uint32    suppressed;
+    OS_time_t last;
+} BUS_COMMS_ErrEventSlot_t;
+
+static BUS_COMMS_ErrEventSlot_t g_err_events[BUS_COMMS_ERR_EVENT_MAX_EID];
+static osal_id_t                g_err_event_mutex;
+
+int32 BUS_COMMS_ErrEventInit(void)
+{
+    memset(g_err_events, 0, sizeof(g_err_events));
+
+    return OS_MutSemCreate(&g_err_event_mutex, "BC_EVT_MUT", 0);
+}
+
+void BUS_COMMS_ErrEvent(uint16 EventID, const char *Spec, ...)
+{
+    BUS_COMMS_ErrEventSlot_t *slot;
+    char                      text[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    uint32                    suppressed = 0;
+    OS_time_t                 now;
+    va_list                   ap;
+
+    if (EventID < BUS_COMMS_ERR_EVENT_MAX_EID)
+    {
+        OS_GetLocalTime(&now);
+
+        OS_MutSemTake(g_err_event_mutex);
+
+        slot = &g_err_events[EventID];
+        if (slot->sent &&
+            OS_TimeGetTotalMilliseconds(OS_TimeSubtract(now, slot->last)) < BUS_COMMS_ERR_EVENT_MIN_MSEC)
+        {
+            slot->suppressed++;
+            BUS_COMMS_STAT_INC(EventsSuppressed);
+            OS_MutSemGive(g_err_event_mutex);
+            return;
+        }
+
+        suppressed       = slot->suppressed;
+        slot->suppressed = 0;
+        slot->sent       = true;
+        slot->last       = now;
+
+        OS_MutSemGive(g_err_event_mutex);
+    }
+
+    va_start(ap, Spec);
+    vsnprintf(text, sizeof(text), Spec, ap);
+    va_end(ap);
+
+    if (suppressed > 0)
+    {
+        CFE_EVS_SendEvent(EventID, CFE_EVS_EventType_ERROR, "%s (%lu suppressed)", text, (unsigned long)suppressed);
+    }
+    else
+    {
+        CFE_EVS_SendEvent(EventID, CFE_EVS_EventType_ERROR, "%s", text);
+    }
+}
@@ -0,0 +1,28 @@
+/************************************************************************
+ * Bus Communications App - rate-limited error events
+ ************************************************************************/
+#ifndef BUS_COMMS_EVENT_H
+#define BUS_COMMS_EVENT_H
+
+#include "cfe.h"
+
+#include <stdint.h>
+
+/*
+ * Errors raised per packet (connect failures, ingest errors, failed
+ * command sends) go through BUS_COMMS_ErrEvent() instead of straight to
+ * EVS, so a failing link produces at most one event per event ID every
+ * BUS_COMMS_ERR_EVENT_MIN_MSEC.  The next event sent for that ID carries
+ * the number held back, and the total is in HK as EventsSuppressed.
+ * Every failure is still counted in its own HK counter.
+ */
+#define BUS_COMMS_ERR_EVENT_MIN_MSEC 1000
+#define BUS_COMMS_ERR_EVENT_MAX_EID  32 /* IDs at or above this are never limited */
+
+int32 BUS_COMMS_ErrEventInit(void);
+
+/* CFE_EVS_SendEvent(EventID, CFE_EVS_EventType_ERROR, ...), rate limited;
+ * the message is only formatted when it is sent */
+void BUS_COMMS_ErrEvent(uint16 EventID, const char *Spec, ...) OS_PRINTF(2, 3);
+
+#endif /* BUS_COMMS_EVENT_H */
@@ -0,0 +1,334 @@
+/************************************************************************
+ * Bus Communications App - message segmentation and reassembly
+ ************************************************************************/
+
+#include "bus_comms_app.h"
+#include "bus_comms_frag.h"
+#include "bus_comms_buf.h"
+#include "bus_comms_txq.h"
+#include "bus_comms_wire.h"
+
+#include <string.h>
+
+#include "osapi.h"
+
+#if BUS_COMMS_FRAG_MAX_MSG > 0xFFFF
+#error "BUS_COMMS_FRAG_MAX_MSG must fit the 16-bit TotalLen header field"
+#endif
+
+typedef struct
+{
+    uint16 Seq;
+    uint16 TotalLen;
+    uint16 Offset;
+    uint16 Index;
+} BUS_COMMS_FragHdr_t;
+
+typedef struct
+{
+    CFE_SB_Buffer_t *buf;       /* NULL when the slot is free */
+    size_t           hdr_len;   /* telemetry header written ahead of the payload */
+    uint16           total_len;
+    uint16           received;
+    uint16           chunk; /* sender's fragment size, 0 until a fragment shows it */
+    uint16           seq;
+    uint8_t          src;
+    uint8_t          port;
+    uint8            seen[BUS_COMMS_FRAG_MAX_FRAGS / 8];
+    OS_time_t        last;
+} BUS_COMMS_FragSlot_t;
+
+static BUS_COMMS_FragSlot_t g_frag_slots[BUS_COMMS_FRAG_POOL_SLOTS];
+static osal_id_t            g_frag_mutex;
+
+/* Only the bridge task sends segmented messages */
+static uint16 g_frag_tx_seq;
+
+static void BUS_COMMS_FragEncode(uint8 *p, const BUS_COMMS_FragHdr_t *hdr)
+{
+    BUS_COMMS_Put16(&p[0], hdr->Seq);
+    BUS_COMMS_Put16(&p[2], hdr->TotalLen);
+    BUS_COMMS_Put16(&p[4], hdr->Offset);
+    BUS_COMMS_Put16(&p[6], hdr->Index);
+}
+
+static void BUS_COMMS_FragDecode(const uint8 *p, BUS_COMMS_FragHdr_t *hdr)
+{
+    hdr->Seq      = BUS_COMMS_Get16(&p[0]);
+    hdr->TotalLen = BUS_COMMS_Get16(&p[2]);
+    hdr->Offset   = BUS_COMMS_Get16(&p[4]);
+    hdr->Index    = BUS_COMMS_Get16(&p[6]);
+}
+
+static void BUS_COMMS_FragSlotFree(BUS_COMMS_FragSlot_t *slot)
+{
+    if (slot->buf != NULL)
+    {
+        CFE_SB_ReleaseMessageBuffer(slot->buf);
+        slot->buf = NULL;
+    }
+}
+
+static void BUS_COMMS_FragSweepLocked(OS_time_t now)
+{
+    for (size_t i = 0; i < BUS_COMMS_FRAG_POOL_SLOTS; ++i)
+    {
+        if (g_frag_slots[i].buf != NULL &&
+            OS_TimeGetTotalMilliseconds(OS_TimeSubtract(now, g_frag_slots[i].last)) > BUS_COMMS_FRAG_TIMEOUT_MSEC)
+        {
+            BUS_COMMS_FragSlotFree(&g_frag_slots[i]);
+            BUS_COMMS_STAT_INC(FragRxTimeouts);
+        }
+    }
+}
+
+/* Find the reassembly for src:port:seq, or start one in a free slot */
+static BUS_COMMS_FragSlot_t *BUS_COMMS_FragSlotGetLocked(const BUS_COMMS_IngestMapEntry_t *entry, uint8_t src,
+                                                         const BUS_COMMS_FragHdr_t *hdr, OS_time_t now)
+{
+    BUS_COMMS_FragSlot_t *slot = NULL;
+
+    for (size_t i = 0; i < BUS_COMMS_FRAG_POOL_SLOTS; ++i)
+    {
+        BUS_COMMS_FragSlot_t *s = &g_frag_slots[i];
+
+        if (s->buf != NULL && s->src == src && s->port == entry->port && s->seq == hdr->Seq)
+        {
+            return (s->total_len == hdr->TotalLen) ? s : NULL;
+        }
+    }
+
+    BUS_COMMS_FragSweepLocked(now);
+
+    for (size_t i = 0; i < BUS_COMMS_FRAG_POOL_SLOTS && slot == NULL; ++i)
+    {
+        if (g_frag_slots[i].buf == NULL)
+        {
+            slot = &g_frag_slots[i];
+        }
+    }
+
+    if (slot == NULL)
+    {
+        return NULL;
+    }
+
+    /* Raw payloads are wrapped in a telemetry header for the mapped MID */
+    slot->hdr_len = CFE_SB_IsValidMsgId(entry->MsgId) ? sizeof(CFE_MSG_TelemetryHeader_t) : 0;
+    slot->buf     = CFE_SB_AllocateMessageBuffer(slot->hdr_len + hdr->TotalLen);
+    if (slot->buf == NULL)
+    {
+        return NULL;
+    }
+
+    if (slot->hdr_len > 0)
+    {
+        CFE_MSG_Init(&slot->buf->Msg, entry->MsgId, slot->hdr_len + hdr->TotalLen);
+    }
+
+    slot->total_len = hdr->TotalLen;
+    slot->received  = 0;
+    slot->chunk     = 0;
+    slot->seq       = hdr->Seq;
+    slot->src       = src;
+    slot->port      = entry->port;
+    memset(slot->seen, 0, sizeof(slot->seen));
+
+    return slot;
+}
+
+/* Fragments must tile the message: every one but the last carries exactly
+ * the sender's chunk at Index * chunk, so distinct indexes never overlap
+ * and 'received' only reaches the total once every byte has been written.
+ * The chunk is learned from the fragments, not assumed from our own pool. */
+static bool BUS_COMMS_FragFitsLocked(BUS_COMMS_FragSlot_t *slot, const BUS_COMMS_FragHdr_t *hdr, size_t n)
+{
+    size_t chunk;
+
+    if (hdr->Offset + n < slot->total_len)
+    {
+        chunk = n;
+    }
+    else if (hdr->Index == 0)
+    {
+        /* The whole message in one fragment */
+        return hdr->Offset == 0 && (slot->chunk == 0 || n <= slot->chunk);
+    }
+    else
+    {
+        /* The last fragment may be short, so its offset tells the chunk */
+        chunk = hdr->Offset / hdr->Index;
+        if (n > chunk)
+        {
+            return false;
+        }
+    }
+
+    if ((slot->chunk != 0 && chunk != slot->chunk) || hdr->Offset != (size_t)hdr->Index * chunk)
+    {
+        return false;
+    }
+
+    slot->chunk = (uint16)chunk;
+    return true;
+}
+
+static void BUS_COMMS_FragPublish(CFE_SB_Buffer_t *BufPtr, size_t hdr_len, uint16 total_len)
+{
+    size_t size = 0;
+
+    if (hdr_len > 0)
+    {
+        CFE_SB_TimeStampMsg(&BufPtr->Msg);
+    }
+    else
+    {
+        /* Complete SB message from the peer's bridge: the header must agree with what arrived */
+        CFE_MSG_GetSize(&BufPtr->Msg, &size);
+        if (total_len < sizeof(CFE_MSG_Message_t) || size != total_len)
+        {
+            CFE_SB_ReleaseMessageBuffer(BufPtr);
+            BUS_COMMS_STAT_INC(FragRxDropped);
+            return;
+        }
+    }
+
+    if (CFE_SB_TransmitBuffer(BufPtr, false) == CFE_SUCCESS)
+    {
+        BUS_COMMS_STAT_INC(FragRxMessages);
+    }
+    else
+    {
+        CFE_SB_ReleaseMessageBuffer(BufPtr);
+        BUS_COMMS_STAT_INC(FragRxDropped);
+    }
+}
+
+int32 BUS_COMMS_FragInit(void)
+{
+    memset(g_frag_slots, 0, sizeof(g_frag_slots));
+
+    return OS_MutSemCreate(&g_frag_mutex, "BC_FRAG_MUT", 0);
+}
+
+int BUS_COMMS_FragSend(uint8_t prio, uint8_t dest, uint8_t port, uint8_t mode, const void *msg, size_t len)
+{
+    BUS_COMMS_FragHdr_t hdr;
+    csp_packet_t       *packet;
+    size_t              chunk = csp_buffer_data_size() - BUS_COMMS_FRAG_HDR_SIZE;
+    size_t              n;
+
+    if (len == 0 || len > BUS_COMMS_FRAG_MAX_MSG || (len + chunk - 1) / chunk > BUS_COMMS_FRAG_MAX_FRAGS)
+    {
+        return -1;
+    }
+
+    hdr.Seq      = g_frag_tx_seq++;
+    hdr.TotalLen = (uint16)len;
+    hdr.Index    = 0;
+
+    for (size_t offset = 0; offset < len; offset += n)
+    {
+        n = (len - offset < chunk) ? (len - offset) : chunk;
+
+        /* The CSP pool can run dry while a long message is queued; wait briefly for a buffer */
+        packet = BUS_COMMS_BufGet(BUS_COMMS_FRAG_HDR_SIZE + n, BUS_COMMS_FRAG_QUEUE_WAIT_MSEC);
+        if (packet == NULL)
+        {
+            /* The receiver discards the partial message when it times out */
+            return -1;
+        }
+
+        hdr.Offset = (uint16)offset;
+        BUS_COMMS_FragEncode(packet->data, &hdr);
+        memcpy(&packet->data[BUS_COMMS_FRAG_HDR_SIZE], (const uint8 *)msg + offset, n);
+        packet->length = (uint16_t)(BUS_COMMS_FRAG_HDR_SIZE + n);
+
+        // Long messages outrun the lane depth, so wait for the TX task instead of dropping
+        if (BUS_COMMS_TxqPushWait(prio, dest, port, mode, packet, BUS_COMMS_FRAG_QUEUE_WAIT_MSEC) != 0)
+        {
+            return -1;
+        }
+
+        hdr.Index++;
+    }
+
+    BUS_COMMS_STAT_INC(FragTxMessages);
+    return 0;
+}
+
+void BUS_COMMS_FragReceive(const BUS_COMMS_IngestMapEntry_t *entry, csp_packet_t *packet)
+{
+    BUS_COMMS_FragHdr_t   hdr;
+    BUS_COMMS_FragSlot_t *slot;
+    CFE_SB_Buffer_t      *done      = NULL;
+    size_t                hdr_len   = 0;
+    uint16                total_len = 0;
+    size_t                n;
+    OS_time_t             now;
+
+    if (packet->length <= BUS_COMMS_FRAG_HDR_SIZE)
+    {
+        BUS_COMMS_STAT_INC(FragRxDropped);
+        csp_buffer_free(packet);
+        return;
+    }
+
+    BUS_COMMS_FragDecode(packet->data, &hdr);
+    n = packet->length - BUS_COMMS_FRAG_HDR_SIZE;
+
+    if (hdr.TotalLen == 0 || hdr.TotalLen > BUS_COMMS_FRAG_MAX_MSG || hdr.Offset + n > hdr.TotalLen ||
+        hdr.Index >= BUS_COMMS_FRAG_MAX_FRAGS)
+    {
+        BUS_COMMS_STAT_INC(FragRxDropped);
+        csp_buffer_free(packet);
+        return;
+    }
+
+    OS_GetLocalTime(&now);
+    OS_MutSemTake(g_frag_mutex);
+
+    slot = BUS_COMMS_FragSlotGetLocked(entry, (uint8_t)packet->id.src, &hdr, now);
+    if (slot == NULL)
+    {
+        /* Pool full, SB allocation failed or the length disagrees with earlier fragments */
+        BUS_COMMS_STAT_INC(FragRxDropped);
+    }
+    else if (!BUS_COMMS_FragFitsLocked(slot, &hdr, n))
+    {
+        BUS_COMMS_STAT_INC(FragRxDropped);
+    }
+    else if ((slot->seen[hdr.Index / 8] & (1u << (hdr.Index % 8))) == 0)
+    {
+        memcpy((uint8 *)slot->buf + slot->hdr_len + hdr.Offset, &packet->data[BUS_COMMS_FRAG_HDR_SIZE], n);
+        slot->seen[hdr.Index / 8] |= (uint8)(1u << (hdr.Index % 8));
+        slot->received += (uint16)n;
+        slot->last = now;
+
+        if (slot->received >= slot->total_len)
+        {
+            done      = slot->buf;
+            hdr_len   = slot->hdr_len;
+            total_len = slot->total_len;
+            slot->buf = NULL;
+        }
+    }
+
+    OS_MutSemGive(g_frag_mutex);
+    csp_buffer_free(packet);
+
+    if (done != NULL)
+    {
+        BUS_COMMS_FragPublish(done, hdr_len, total_len);
+    }
+}
+
+void BUS_COMMS_FragSweep(void)
+{
+    OS_time_t now;
+
+    OS_GetLocalTime(&now);
+    OS_MutSemTake(g_frag_mutex);
+    BUS_COMMS_FragSweepLocked(now);
+    OS_MutSemGive(g_frag_mutex);
+}
@@ -0,0 +1,57 @@
+/************************************************************************
+ * Bus Communications App - message segmentation and reassembly
+ ************************************************************************/
+#ifndef BUS_COMMS_FRAG_H
+#define BUS_COMMS_FRAG_H
+
+#include "cfe.h"
+
+#include <stdint.h>
+
+#include <csp/csp.h>
+
+#include "cfe_mission_cfg.h"
+
+#include "bus_comms_table.h"
+
+/*
+ * Mappings marked 'segmented' carry every message as one or more
+ * fragments, each starting with this header in network byte order:
+ *
+ *   Seq       message sequence number, per sender
+ *   TotalLen  length of the whole message
+ *   Offset    position of this fragment's data in the message
+ *   Index     fragment number, 0 .. ceil(TotalLen / chunk) - 1
+ *
+ * Offset is always Index * chunk, and every fragment but the last carries
+ * exactly chunk bytes.  The receiver learns the sender's chunk from the
+ * fragments themselves and drops any that do not fit that layout.
+ *
+ * The receiver reassembles straight into an SB buffer.  At most
+ * BUS_COMMS_FRAG_POOL_SLOTS messages are in flight at once; a message not
+ * completed within BUS_COMMS_FRAG_TIMEOUT_MSEC of its last fragment is
+ * discarded.
+ */
+#define BUS_COMMS_FRAG_HDR_SIZE     8
+#define BUS_COMMS_FRAG_MAX_MSG      CFE_MISSION_SB_MAX_SB_MSG_SIZE
+#define BUS_COMMS_FRAG_MAX_FRAGS    256
+#define BUS_COMMS_FRAG_POOL_SLOTS   4
+#define BUS_COMMS_FRAG_TIMEOUT_MSEC 2000
+
+/* How long the sender waits for TX queue space for each fragment */
+#define BUS_COMMS_FRAG_QUEUE_WAIT_MSEC 500
+
+int32 BUS_COMMS_FragInit(void);
+
+/* Split 'msg' into fragments and queue them for dest:port; the message
+ * is copied.  Returns 0 if every fragment was queued. */
+int BUS_COMMS_FragSend(uint8_t prio, uint8_t dest, uint8_t port, uint8_t mode, const void *msg, size_t len);
+
+/* Add a received fragment for 'entry' and publish the message once it is
+ * complete.  Takes ownership of 'packet'. */
+void BUS_COMMS_FragReceive(const BUS_COMMS_IngestMapEntry_t *entry, csp_packet_t *packet);
+
+/* Discard reassemblies that have timed out */
+void BUS_COMMS_FragSweep(void);
+
+#endif /* BUS_COMMS_FRAG_H */
@@ -0,0 +1,160 @@
+/************************************************************************
+ * Bus Communications App - node heartbeat
+ ************************************************************************/
+
+#include "bus_comms_app.h"
+#include "bus_comms_hb.h"
+#include "bus_comms_buf.h"
+#include "bus_comms_iface.h"
+#include "bus_comms_route.h"
+#include "bus_comms_sched.h"
+#include "bus_comms_txq.h"
+#include "bus_comms_wire.h"
+
+#include <string.h>
+
+#include "cfe_time.h"
+#include "osapi.h"
+
+#define BUS_COMMS_HB_REQUEST 1
+#define BUS_COMMS_HB_ECHO    2
+
+static uint8_t   g_hb_port;
+static uint32    g_hb_period;
+static uint16    g_hb_miss_limit;
+static uint8_t   g_hb_peers[BUS_COMMS_HB_MAX_PEERS];
+static uint32    g_hb_peer_count;
+static uint32    g_hb_seq;
+static OS_time_t g_hb_due;
+
+static void BUS_COMMS_HbAddPeer(uint8_t addr, uint8_t my_addr)
+{
+    if (addr == my_addr || g_hb_peer_count >= BUS_COMMS_HB_MAX_PEERS)
+    {
+        return;
+    }
+
+    for (uint32 i = 0; i < g_hb_peer_count; ++i)
+    {
+        if (g_hb_peers[i] == addr)
+        {
+            return;
+        }
+    }
+
+    g_hb_peers[g_hb_peer_count++] = addr;
+}
+
+void BUS_COMMS_HbInit(const BUS_COMMS_Table_t *Tbl, uint8_t my_addr)
+{
+    g_hb_port       = Tbl->HbPort;
+    g_hb_period     = Tbl->HbPeriodMsec;
+    g_hb_miss_limit = Tbl->HbMissLimit;
+    g_hb_peer_count = 0;
+    g_hb_seq        = 0;
+
+    /* Every node the map knows about, whichever side of a pairing it is on */
+    BUS_COMMS_HbAddPeer(Tbl->DefaultNode.PeerAddr, my_addr);
+    for (uint32 i = 0; i < BUS_COMMS_MAX_NODE_MAPPINGS; ++i)
+    {
+        if (Tbl->NodeMap[i].InUse)
+        {
+            BUS_COMMS_HbAddPeer(Tbl->NodeMap[i].MyAddr, my_addr);
+            BUS_COMMS_HbAddPeer(Tbl->NodeMap[i].PeerAddr, my_addr);
+        }
+    }
+
+    OS_GetLocalTime(&g_hb_due);
+}
+
+uint32 BUS_COMMS_HbRun(void)
+{
+    CFE_TIME_SysTime_t stamp;
+    OS_time_t          now;
+    int64              remaining;
+    csp_packet_t      *packet;
+    uint32             missed;
+
+    if (g_hb_port == 0 || g_hb_peer_count == 0)
+    {
+        return BUS_COMMS_SCHED_IDLE_MSEC;
+    }
+
+    OS_GetLocalTime(&now);
+    remaining = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(g_hb_due, now));
+    if (remaining > 0)
+    {
+        return (uint32)remaining;
+    }
+
+    stamp = CFE_TIME_GetTime();
+    g_hb_seq++;
+
+    for (uint32 i = 0; i < g_hb_peer_count; ++i)
+    {
+        packet = BUS_COMMS_BufGet(BUS_COMMS_HB_LEN, 0);
+        if (packet == NULL)
+        {
+            break;
+        }
+
+        packet->data[0] = BUS_COMMS_HB_REQUEST;
+        BUS_COMMS_Put32(&packet->data[1], g_hb_seq);
+        BUS_COMMS_Put32(&packet->data[5], stamp.Seconds);
+        BUS_COMMS_Put32(&packet->data[9], stamp.Subseconds);
+        packet->length = BUS_COMMS_HB_LEN;
+
+        /* Every further HbMissLimit + 1 misses, try the node's other interface;
+         * this heartbeat already goes out on it */
+        missed = BUS_COMMS_RouteHeartbeatSent(g_hb_peers[i], g_hb_miss_limit);
+        if (missed % (g_hb_miss_limit + 1u) == 0)
+        {
+            BUS_COMMS_IfaceFailover(g_hb_peers[i], missed == g_hb_miss_limit + 1u);
+        }
+
+        /* High priority so queueing behind bulk traffic does not read as loss */
+        BUS_COMMS_TxqPush(CSP_PRIO_HIGH, g_hb_peers[i], g_hb_port, BUS_COMMS_PORT_MODE_DGRAM, packet);
+    }
+
+    g_hb_due = OS_TimeAdd(now, OS_TimeFromTotalMilliseconds(g_hb_period));
+
+    return g_hb_period;
+}
+
+void BUS_COMMS_HbReceive(csp_packet_t *packet)
+{
+    CFE_TIME_SysTime_t sent;
+    CFE_TIME_SysTime_t now;
+    CFE_TIME_SysTime_t rtt;
+
+    if (packet->length != BUS_COMMS_HB_LEN)
+    {
+        csp_buffer_free(packet);
+        return;
+    }
+
+    if (packet->data[0] == BUS_COMMS_HB_REQUEST)
+    {
+        /* Echo the buffer back as-is; the TX queue owns it from here */
+        packet->data[0] = BUS_COMMS_HB_ECHO;
+        BUS_COMMS_TxqPush(CSP_PRIO_HIGH, (uint8_t)packet->id.src, g_hb_port, BUS_COMMS_PORT_MODE_DGRAM, packet);
+        return;
+    }
+
+    if (packet->data[0] == BUS_COMMS_HB_ECHO)
+    {
+        now             = CFE_TIME_GetTime();
+        sent.Seconds    = BUS_COMMS_Get32(&packet->data[5]);
+        sent.Subseconds = BUS_COMMS_Get32(&packet->data[9]);
+
+        /* Ignore echoes stamped in the future, e.g. across a time jump */
+        if (CFE_TIME_Compare(now, sent) != CFE_TIME_A_LT_B)
+        {
+            rtt = CFE_TIME_Subtract(now, sent);
+            BUS_COMMS_RouteHeartbeatAck((uint8_t)packet->id.src, BUS_COMMS_Get32(&packet->data[1]),
+                                        rtt.Seconds * 1000000 + CFE_TIME_Sub2MicroSecs(rtt.Subseconds));
+        }
+    }
+
+    csp_buffer_free(packet);
+}
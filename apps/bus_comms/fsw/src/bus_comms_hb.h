@@ -0,0 +1,36 @@
+/************************************************************************
+ * Bus Communications App - node heartbeat
+ ************************************************************************/
+#ifndef BUS_COMMS_HB_H
+#define BUS_COMMS_HB_H
+
+#include "cfe.h"
+
+#include <stdint.h>
+
+#include <csp/csp.h>
+
+#include "bus_comms_table.h"
+
+/*
+ * Every HbPeriodMsec the TX task sends a heartbeat datagram to each other
+ * node named in the node map.  A heartbeat carries a sequence number and
+ * the sender's CFE_TIME_GetTime(); the receiver returns it unchanged as an
+ * echo, so the round trip is measured on the sender's clock alone.  Echoes
+ * feed RTT, jitter and loss in the route table, and a node that misses
+ * more than HbMissLimit echoes in a row is marked dead until it answers
+ * again (see BUS_COMMS_RouteIsDead()) and its interface route, if it has a
+ * backup, fails over (see BUS_COMMS_IfaceFailover()).
+ */
+#define BUS_COMMS_HB_LEN       13 /* type, seq(4), seconds(4), subseconds(4) */
+#define BUS_COMMS_HB_MAX_PEERS 16
+
+void BUS_COMMS_HbInit(const BUS_COMMS_Table_t *Tbl, uint8_t my_addr);
+
+/* Queue the heartbeats that are due and return the msec until the next round */
+uint32 BUS_COMMS_HbRun(void);
+
+/* Handle a packet received on HbPort; takes ownership of 'packet' */
+void BUS_COMMS_HbReceive(csp_packet_t *packet);
+
+#endif /* BUS_COMMS_HB_H */
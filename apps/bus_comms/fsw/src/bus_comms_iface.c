@@ -0,0 +1,247 @@
+/************************************************************************
+ * Bus Communications App - CSP interfaces and per-node routes
+ ************************************************************************/
+
+#include "bus_comms_app.h"
+#include "bus_comms_conn.h"
+#include "bus_comms_events.h"
+#include "bus_comms_iface.h"
+
+#include <string.h>
+
+#include <csp/csp.h>
+#include <csp/csp_id.h>
+#include <csp/csp_rtable.h>
+#include <csp/interfaces/csp_if_can.h>
+#include <csp/interfaces/csp_if_lo.h>
+#include <csp/interfaces/csp_if_zmqhub.h>
+#include <csp/drivers/can_socketcan.h>
+
+typedef struct
+{
+    uint8_t dest;
+    uint8_t primary;
+    uint8_t backup;
+    uint8_t active;    /* interface the CSP route uses; router task only after init */
+    uint8_t requested; /* interface the TX task asked for; atomic */
+    bool    announce;  /* raise the failover event when applied; atomic */
+} BUS_COMMS_IfRoute_t;
+
+static csp_iface_t        *g_if_list[BUS_COMMS_MAX_INTERFACES];
+static uint8_t             g_if_type[BUS_COMMS_MAX_INTERFACES];
+static BUS_COMMS_IfRoute_t g_if_routes[BUS_COMMS_MAX_IF_ROUTES];
+static uint32              g_if_route_count;
+static bool                g_if_requests; /* some 'requested' changed; atomic */
+
+bool BUS_COMMS_IfaceLoopbackOnly(const BUS_COMMS_Table_t *Tbl)
+{
+    for (uint32 i = 0; i < BUS_COMMS_MAX_INTERFACES; ++i)
+    {
+        if (Tbl->Interfaces[i].InUse && Tbl->Interfaces[i].Type != BUS_COMMS_IF_TYPE_LOOPBACK)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static int BUS_COMMS_IfaceOpen(const BUS_COMMS_InterfaceEntry_t *e, uint8_t my_addr, csp_iface_t **iface)
+{
+    switch (e->Type)
+    {
+        case BUS_COMMS_IF_TYPE_CAN:
+            // The device name doubles as the CSP interface name so several buses stay apart
+            return csp_can_socketcan_open_and_add_interface(e->Device, e->Device, my_addr, (int)e->Bitrate, false,
+                                                            iface);
+
+        case BUS_COMMS_IF_TYPE_ZMQ:
+            return csp_zmqhub_init(my_addr, e->Device, 0, iface);
+
+        default:
+            // csp_init() already routes our own address through loopback
+            *iface = &csp_if_lo;
+            return CSP_ERR_NONE;
+    }
+}
+
+static int BUS_COMMS_IfaceRoute(uint8_t dest, uint8_t index)
+{
+    return csp_rtable_set(dest, csp_id_get_host_bits(), g_if_list[index], CSP_NO_VIA_ADDRESS);
+}
+
+int32 BUS_COMMS_IfaceInit(const BUS_COMMS_Table_t *Tbl, uint8_t my_addr, uint8_t peer_addr)
+{
+    const BUS_COMMS_InterfaceEntry_t *e;
+    const BUS_COMMS_IfRouteEntry_t   *re;
+    BUS_COMMS_IfRoute_t              *r;
+    csp_iface_t                      *iface;
+    int                               err;
+
+    memset(g_if_list, 0, sizeof(g_if_list));
+    g_if_route_count = 0;
+    g_if_requests    = false;
+
+    for (uint32 i = 0; i < BUS_COMMS_MAX_INTERFACES; ++i)
+    {
+        e = &Tbl->Interfaces[i];
+        if (!e->InUse)
+        {
+            continue;
+        }
+
+        iface = NULL;
+        err   = BUS_COMMS_IfaceOpen(e, my_addr, &iface);
+        if (err != CSP_ERR_NONE || iface == NULL)
+        {
+            CFE_ES_WriteToSysLog("BUS_COMMS: CSP interface %s open failed err=%d\n", e->Device, err);
+            return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+
+        if (e->IsDefault)
+        {
+            iface->is_default = 1;
+        }
+
+        g_if_list[i] = iface;
+        g_if_type[i] = e->Type;
+    }
+
+    for (uint32 i = 0; i < BUS_COMMS_MAX_IF_ROUTES; ++i)
+    {
+        re = &Tbl->InterfaceRoutes[i];
+        if (!re->InUse)
+        {
+            continue;
+        }
+
+        // One table serves every node, so it may hold a route to ourselves
+        r       = &g_if_routes[g_if_route_count];
+        r->dest = (re->dest == BUS_COMMS_ADDR_PEER) ? peer_addr : re->dest;
+        if (r->dest == my_addr)
+        {
+            continue;
+        }
+
+        g_if_route_count++;
+        r->primary   = re->Primary;
+        r->backup    = re->Backup;
+        r->active    = re->Primary;
+        r->requested = re->Primary;
+        r->announce  = false;
+
+        err = BUS_COMMS_IfaceRoute(r->dest, r->active);
+        if (err != CSP_ERR_NONE)
+        {
+            CFE_ES_WriteToSysLog("BUS_COMMS: CSP route to %u failed err=%d\n", (unsigned)r->dest, err);
+            return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+    }
+
+    return CFE_SUCCESS;
+}
+
+void BUS_COMMS_IfaceFailover(uint8_t addr, bool first)
+{
+    BUS_COMMS_IfRoute_t *r = NULL;
+    uint8_t              next;
+
+    for (uint32 i = 0; i < g_if_route_count; ++i)
+    {
+        if (g_if_routes[i].dest == addr)
+        {
+            r = &g_if_routes[i];
+            break;
+        }
+    }
+
+    if (r == NULL || r->backup == BUS_COMMS_IF_NONE)
+    {
+        return;
+    }
+
+    // Alternate, so a primary that comes back is found again while the node stays silent.
+    // Only this task writes 'requested'; the router task applies it between passes.
+    next = (r->requested == r->primary) ? r->backup : r->primary;
+    if (first)
+    {
+        __atomic_store_n(&r->announce, true, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&r->requested, next, __ATOMIC_RELAXED);
+    __atomic_store_n(&g_if_requests, true, __ATOMIC_RELEASE);
+
+    // Connections opened over the old interface would keep their stale state
+    BUS_COMMS_ConnCacheInvalidate(addr);
+}
+
+void BUS_COMMS_IfaceApply(void)
+{
+    BUS_COMMS_IfRoute_t *r;
+    uint8_t              want;
+    int                  err;
+
+    if (!__atomic_exchange_n(&g_if_requests, false, __ATOMIC_ACQUIRE))
+    {
+        return;
+    }
+
+    for (uint32 i = 0; i < g_if_route_count; ++i)
+    {
+        r    = &g_if_routes[i];
+        want = __atomic_load_n(&r->requested, __ATOMIC_RELAXED);
+        if (want == r->active)
+        {
+            continue;
+        }
+
+        err = BUS_COMMS_IfaceRoute(r->dest, want);
+        if (err != CSP_ERR_NONE)
+        {
+            CFE_ES_WriteToSysLog("BUS_COMMS: CSP route to %u not moved err=%d\n", (unsigned)r->dest, err);
+            continue;
+        }
+
+        r->active = want;
+        BUS_COMMS_STAT_INC(IfFailovers);
+
+        if (__atomic_exchange_n(&r->announce, false, __ATOMIC_RELAXED))
+        {
+            CFE_EVS_SendEvent(BUS_COMMS_IF_FAILOVER_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "BUS_COMMS: node %u rerouted to interface %s", (unsigned)r->dest,
+                              g_if_list[want]->name);
+        }
+    }
+}
+
+void BUS_COMMS_IfaceClose(void)
+{
+    // Every route here points at one of our interfaces; drop them before the
+    // CAN driver frees its interface so nothing is left to look one up
+    csp_rtable_clear();
+    g_if_route_count = 0;
+
+    for (uint32 i = 0; i < BUS_COMMS_MAX_INTERFACES; ++i)
+    {
+        if (g_if_list[i] == NULL)
+        {
+            continue;
+        }
+
+        if (g_if_type[i] == BUS_COMMS_IF_TYPE_CAN)
+        {
+            // Joins the driver's RX thread and closes the socket
+            if (csp_can_socketcan_stop(g_if_list[i]) != CSP_ERR_NONE)
+            {
+                CFE_ES_WriteToSysLog("BUS_COMMS: CSP interface %s did not stop\n", g_if_list[i]->name);
+            }
+        }
+        else if (g_if_type[i] == BUS_COMMS_IF_TYPE_ZMQ)
+        {
+            // libcsp has no way to stop the ZMQ hub's RX thread
+            CFE_ES_WriteToSysLog("BUS_COMMS: CSP interface %s left open, reload needs a processor restart\n",
+                                 g_if_list[i]->name);
+        }
+
+        g_if_list[i] = NULL;
+    }
+}
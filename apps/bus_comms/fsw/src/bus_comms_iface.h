@@ -0,0 +1,47 @@
+/************************************************************************
+ * Bus Communications App - CSP interfaces and per-node routes
+ ************************************************************************/
+#ifndef BUS_COMMS_IFACE_H
+#define BUS_COMMS_IFACE_H
+
+#include "cfe.h"
+
+#include <stdint.h>
+
+#include "bus_comms_table.h"
+
+/*
+ * The table's Interfaces are opened once at startup and each
+ * InterfaceRoutes entry becomes a CSP host route on its Primary
+ * interface; everything else leaves through the default interface.  When
+ * the heartbeat finds a routed node unreachable the route is moved to the
+ * entry's Backup (see BUS_COMMS_IfaceFailover()).  The heartbeat runs
+ * on the TX task, which only records the request; the router task makes
+ * every route change after init (BUS_COMMS_IfaceApply()), between its
+ * csp_route_work() passes, so no lock is held across libcsp's blocking
+ * wait.  A change only rewrites the interface of a route installed at
+ * init, so a concurrent lookup by the TX task sees the old or the new one.
+ */
+
+/* True when the table opens no CAN or ZMQ interface */
+bool BUS_COMMS_IfaceLoopbackOnly(const BUS_COMMS_Table_t *Tbl);
+
+/* Open every interface and install the routes; call after csp_init() */
+int32 BUS_COMMS_IfaceInit(const BUS_COMMS_Table_t *Tbl, uint8_t my_addr, uint8_t peer_addr);
+
+/* Ask for the route to 'addr' to move to its other interface, if it has
+ * one.  Called from the TX task each time another HbMissLimit + 1
+ * heartbeats go unanswered; only the first switch of an outage ('first')
+ * raises an event */
+void BUS_COMMS_IfaceFailover(uint8_t addr, bool first);
+
+/* Apply the requested route moves; router task only, between passes */
+void BUS_COMMS_IfaceApply(void);
+
+/* Remove the CSP routes, then stop the interface drivers' threads and
+ * close their sockets.  Only at app shutdown once every child task has
+ * exited: the router task must not be walking the table or the iflist
+ * when a driver frees its interface */
+void BUS_COMMS_IfaceClose(void);
+
+#endif /* BUS_COMMS_IFACE_H */
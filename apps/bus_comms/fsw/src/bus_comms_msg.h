@@ -5,9 +5,78 @@
 #define BUS_COMMS_MSG_H
 
 #include "cfe_msg.h"
+#include "cfe_time.h"
+#include "cfe_mission_cfg.h"
 
 #define BUS_COMMS_NOOP_CC           0
 #define BUS_COMMS_RESET_COUNTERS_CC 1
+#define BUS_COMMS_SEND_CSP_CC       0x10
+#define BUS_COMMS_LIST_ROUTES_CC    0x11
+#define BUS_COMMS_WRITE_ROUTES_CC   0x12
+#define BUS_COMMS_SEND_CSP_BATCH_CC 0x13
+#define BUS_COMMS_XFER_SEND_CC      0x14
+#define BUS_COMMS_XFER_ABORT_CC     0x15
+#define BUS_COMMS_BENCH_CC          0x16
+
+/* Route entries carried per BUS_COMMS_RouteTlm_t packet */
+#define BUS_COMMS_ROUTE_TLM_ENTRIES 16
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHdr;
+    char                    Filename[CFE_MISSION_MAX_PATH_LEN]; /* empty selects the default dump file */
+} BUS_COMMS_WriteRoutesCmd_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHdr;
+    uint8                   Dest; /* CSP node, BUS_COMMS_ADDR_PEER for the configured peer */
+    uint8                   Spare[3];
+    char                    SrcFilename[CFE_MISSION_MAX_PATH_LEN]; /* local file */
+    char                    DstFilename[CFE_MISSION_MAX_PATH_LEN]; /* path on the destination node */
+} BUS_COMMS_XferSendCmd_t;
+
+/* Destinations a single benchmark run can spread its packets over */
+#define BUS_COMMS_BENCH_MAX_DESTS 8
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHdr;
+    uint16                  Count;      /* packets to send, at most BUS_COMMS_BENCH_MAX_PACKETS */
+    uint16                  PayloadLen; /* bytes per packet, including the benchmark header */
+    uint32                  RateHz;     /* packets per second, 0 sends as fast as the TX queue accepts */
+    uint8                   DestCount;
+    uint8                   Dests[BUS_COMMS_BENCH_MAX_DESTS]; /* round-robin; BUS_COMMS_ADDR_PEER allowed */
+    uint8                   Spare[3];
+} BUS_COMMS_BenchCmd_t;
+
+/* Batch send limits: records per command and bytes of packed record data */
+#define BUS_COMMS_MAX_BATCH_RECORDS 32
+#define BUS_COMMS_MAX_BATCH_DATA    4096
+
+/* Header of each record in BUS_COMMS_SendCspBatchCmd_t.Records; 'len' data
+ * bytes follow immediately, and the next record starts right after them */
+typedef struct
+{
+    uint8  Dest;
+    uint8  Port;
+    uint16 Len;
+} BUS_COMMS_BatchRecordHdr_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHdr;
+    uint16                  BatchId;     /* echoed in BUS_COMMS_BatchStatusTlm_t */
+    uint8                   RecordCount;
+    uint8                   Spare;
+    uint8                   Records[BUS_COMMS_MAX_BATCH_DATA]; /* may be sent short */
+} BUS_COMMS_SendCspBatchCmd_t;
+
+/* Per-record outcome reported in BUS_COMMS_BatchStatusTlm_t */
+#define BUS_COMMS_BATCH_QUEUED     0 /* handed to the TX queue */
+#define BUS_COMMS_BATCH_BAD_LENGTH 1 /* record runs past the command or is empty/too long */
+#define BUS_COMMS_BATCH_NO_BUFFER  2 /* CSP buffer pool exhausted */
+#define BUS_COMMS_BATCH_QUEUE_FULL 3 /* TX queue lane full */
 
 typedef struct
 {
@@ -16,7 +85,127 @@ typedef struct
         uint8 CommandCounter;
         uint8 CommandErrorCounter;
         uint8 Spare[2];
+        uint32 ConnCacheHits;
+        uint32 ConnCacheMisses;
+        uint32 ConnCacheEvictions;
+        uint32 BridgeForwarded;
+        uint32 BridgeDropped;
+        uint32 IngestPackets;
+        uint32 IngestErrors;
+        uint32 RouteCount;
+        uint32 RouteEvictions;
+        uint32 TxQueued;
+        uint32 TxQueueFull;
+        uint32 TxThrottled;
+        uint32 TxConnErrors;
+        uint32 TxDeadDrops;
+        uint32 TxTimeouts;
+        uint32 IfFailovers;
+        uint32 CspBufTotal;       /* libcsp pool size (CSP_BUFFER_COUNT) */
+        uint32 CspBufFree;        /* free at the time of this report */
+        uint32 CspBufPeakUsed;    /* most in use at once since reset */
+        uint32 CspBufAllocFails;
+        uint32 EventsSuppressed;  /* error events held back by the rate limit */
+        uint32 RouterPackets;     /* passes that routed a packet */
+        uint32 RouterIdlePasses;  /* passes that timed out with no input */
+        uint32 FragTxMessages;
+        uint32 FragRxMessages;
+        uint32 FragRxDropped;
+        uint32 FragRxTimeouts;
+        uint32 XferTxFiles;
+        uint32 XferRxFiles;
+        uint32 XferTxBytes;
+        uint32 XferRxBytes;
+        uint32 XferRetransmits;
+        uint32 XferErrors;
+        uint32 XferLastRate;      /* bytes/s of the last completed send */
     } Payload;
 } BUS_COMMS_HkTlm_t;
 
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader;
+    struct {
+        uint16 BatchId;
+        uint8  RecordCount;
+        uint8  SentCount;
+        uint8  Status[BUS_COMMS_MAX_BATCH_RECORDS]; /* BUS_COMMS_BATCH_* */
+    } Payload;
+} BUS_COMMS_BatchStatusTlm_t;
+
+/* Result of one benchmark run; latencies are round trips through the echo */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader;
+    struct {
+        uint16 RunId;
+        uint16 PayloadLen;
+        uint32 RateHz;
+        uint8  DestCount;
+        uint8  Spare[3];
+        uint32 Sent;         /* accepted by the TX queue */
+        uint32 SendFailed;   /* no CSP buffer or TX queue full */
+        uint32 Received;     /* distinct replies */
+        uint32 Dropped;      /* Sent - Received */
+        uint32 ElapsedMsec;  /* first send to last reply */
+        uint32 PacketsPerSec;
+        uint32 LatP50Usec;
+        uint32 LatP99Usec;
+        uint32 LatMaxUsec;
+    } Payload;
+} BUS_COMMS_BenchTlm_t;
+
+/* Outcome of a command's send, in BUS_COMMS_SendStatusTlm_t */
+#define BUS_COMMS_SEND_OK          0 /* handed to CSP */
+#define BUS_COMMS_SEND_CONN_FAILED 1 /* csp_connect failed within the budget */
+#define BUS_COMMS_SEND_TIMEOUT     2 /* budget spent while queued or throttled */
+#define BUS_COMMS_SEND_DEAD_NODE   3 /* destination marked dead by heartbeats */
+
+/* Completion of one SEND_CSP command or SEND_CSP_BATCH record.  Tag is the
+ * command's CCSDS sequence count for SEND_CSP and the BatchId for batches. */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader;
+    struct {
+        uint16 Tag;
+        uint8  Dest;
+        uint8  Port;
+        uint8  Status;      /* BUS_COMMS_SEND_* */
+        uint8  Spare[3];
+        uint32 ElapsedMsec; /* queued to completion */
+    } Payload;
+} BUS_COMMS_SendStatusTlm_t;
+
+/* One node of the routing table, as published and as written to file */
+typedef struct
+{
+    uint8              Addr;
+    uint8              Dead;     /* heartbeats unanswered past HbMissLimit */
+    uint16             LastPort;
+    uint32             RxCount;
+    uint32             TxCount;
+    uint32             RxBytes;
+    uint32             TxBytes;
+    uint32             RxRate;
+    uint32             TxRate;
+    CFE_TIME_SysTime_t LastSeen;
+    uint32             RttUsec;  /* heartbeat round trip, smoothed */
+    uint32             JitterUsec; /* smoothed deviation from RttUsec */
+    uint32             LossPct;  /* heartbeat loss, smoothed */
+} BUS_COMMS_RouteTlmEntry_t;
+
+/* LIST_ROUTES response; a table larger than one packet is sent as
+ * consecutive packets with increasing FirstIndex */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader;
+    struct {
+        uint16                    TotalEntries;
+        uint16                    FirstIndex;
+        uint16                    EntryCount;
+        uint16                    Spare;
+        BUS_COMMS_RouteTlmEntry_t Entries[BUS_COMMS_ROUTE_TLM_ENTRIES];
+    } Payload;
+} BUS_COMMS_RouteTlm_t;
+
 #endif /* BUS_COMMS_MSG_H */
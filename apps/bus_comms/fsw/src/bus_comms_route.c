@@ -0,0 +1,509 @@
+/************************************************************************
+ * Bus Communications App - CSP node routing table
+ ************************************************************************/
+
+#include "bus_comms_app.h"
+#include "bus_comms_route.h"
+#include "bus_comms_conn.h"
+#include "bus_comms_events.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cfe_time.h"
+#include "osapi.h"
+
+#define BUS_COMMS_ROUTE_NONE (-1)
+
+typedef struct
+{
+    bus_comms_route_entry_t info;
+    int16                   next;    /* next slot in the same hash chain */
+    bool                    in_use;
+    uint32                  rx_bytes_sampled;
+    uint32                  tx_bytes_sampled;
+    uint32                  hb_sent_sampled;
+    uint32                  hb_acked_sampled;
+} BUS_COMMS_RouteSlot_t;
+
+static BUS_COMMS_RouteSlot_t g_routes[BUS_COMMS_MAX_ROUTES];
+static int16                 g_route_buckets[BUS_COMMS_ROUTE_HASH_BUCKETS];
+static int16                 g_route_free;
+static osal_id_t             g_route_mutex;
+static OS_time_t             g_route_last_sample;
+static CFE_ES_AppId_t        g_route_app_id;
+
+static BUS_COMMS_RouteTlmEntry_t g_route_tlm_entries[BUS_COMMS_MAX_ROUTES];
+static BUS_COMMS_RouteTlm_t      g_route_tlm;
+
+typedef struct
+{
+    CFE_FS_FileWriteMetaData_t FileWrite;
+    uint32                     EntryCount;
+    BUS_COMMS_RouteTlmEntry_t  Entries[BUS_COMMS_MAX_ROUTES];
+} BUS_COMMS_RouteFileState_t;
+
+static BUS_COMMS_RouteFileState_t g_route_file;
+
+static inline uint32 BUS_COMMS_RouteHash(uint8_t addr)
+{
+    return addr & (BUS_COMMS_ROUTE_HASH_BUCKETS - 1);
+}
+
+static void BUS_COMMS_RouteUnlink(int16 idx)
+{
+    int16 *link = &g_route_buckets[BUS_COMMS_RouteHash(g_routes[idx].info.addr)];
+
+    while (*link != idx)
+    {
+        link = &g_routes[*link].next;
+    }
+    *link = g_routes[idx].next;
+
+    g_routes[idx].in_use = false;
+    g_routes[idx].next   = g_route_free;
+    g_route_free         = idx;
+
+    BUS_COMMS_STAT_SUB(RouteCount, 1);
+    BUS_COMMS_STAT_INC(RouteEvictions);
+}
+
+/* Caller holds g_route_mutex */
+static BUS_COMMS_RouteSlot_t *BUS_COMMS_RouteFindOrAdd(uint8_t addr, CFE_TIME_SysTime_t now)
+{
+    uint32 bucket = BUS_COMMS_RouteHash(addr);
+    int16  idx;
+
+    for (idx = g_route_buckets[bucket]; idx != BUS_COMMS_ROUTE_NONE; idx = g_routes[idx].next)
+    {
+        if (g_routes[idx].info.addr == addr)
+        {
+            return &g_routes[idx];
+        }
+    }
+
+    if (g_route_free == BUS_COMMS_ROUTE_NONE)
+    {
+        /* Full: make room by evicting the node seen least recently */
+        int16 oldest = 0;
+
+        for (idx = 1; idx < BUS_COMMS_MAX_ROUTES; ++idx)
+        {
+            if (CFE_TIME_Compare(g_routes[idx].info.last_seen, g_routes[oldest].info.last_seen) ==
+                CFE_TIME_A_LT_B)
+            {
+                oldest = idx;
+            }
+        }
+        BUS_COMMS_RouteUnlink(oldest);
+    }
+
+    idx          = g_route_free;
+    g_route_free = g_routes[idx].next;
+
+    memset(&g_routes[idx], 0, sizeof(g_routes[idx]));
+    g_routes[idx].info.addr      = addr;
+    g_routes[idx].info.last_seen = now;
+    g_routes[idx].in_use         = true;
+    g_routes[idx].next           = g_route_buckets[bucket];
+    g_route_buckets[bucket]      = idx;
+
+    BUS_COMMS_STAT_INC(RouteCount);
+
+    return &g_routes[idx];
+}
+
+int32 BUS_COMMS_RouteInit(void)
+{
+    memset(g_routes, 0, sizeof(g_routes));
+
+    for (int16 i = 0; i < BUS_COMMS_ROUTE_HASH_BUCKETS; ++i)
+    {
+        g_route_buckets[i] = BUS_COMMS_ROUTE_NONE;
+    }
+
+    /* Chain every slot onto the free list */
+    for (int16 i = 0; i < BUS_COMMS_MAX_ROUTES; ++i)
+    {
+        g_routes[i].next = (i + 1 < BUS_COMMS_MAX_ROUTES) ? (int16)(i + 1) : BUS_COMMS_ROUTE_NONE;
+    }
+    g_route_free = 0;
+
+    OS_GetLocalTime(&g_route_last_sample);
+    CFE_ES_GetAppID(&g_route_app_id);
+
+    CFE_MSG_Init(CFE_MSG_PTR(g_route_tlm.TelemetryHeader), CFE_SB_ValueToMsgId(BUS_COMMS_ROUTE_TLM_MID),
+                 sizeof(g_route_tlm));
+
+    return OS_MutSemCreate(&g_route_mutex, "BC_ROUTE_MUT", 0);
+}
+
+void BUS_COMMS_RouteUpdateRx(uint8_t addr, uint16_t port, uint16_t bytes)
+{
+    CFE_TIME_SysTime_t     now = CFE_TIME_GetTime();
+    BUS_COMMS_RouteSlot_t *slot;
+
+    CFE_ES_PerfLogEntry(BUS_COMMS_ROUTE_UPDATE_PERF_ID);
+    OS_MutSemTake(g_route_mutex);
+
+    slot = BUS_COMMS_RouteFindOrAdd(addr, now);
+    slot->info.rx_count++;
+    slot->info.rx_bytes += bytes;
+    slot->info.last_port = port;
+    slot->info.last_seen = now;
+
+    OS_MutSemGive(g_route_mutex);
+
+    CFE_ES_PerfLogExit(BUS_COMMS_ROUTE_UPDATE_PERF_ID);
+}
+
+void BUS_COMMS_RouteUpdateTx(uint8_t addr, uint16_t port, uint16_t bytes)
+{
+    BUS_COMMS_RouteUpdateTxCount(addr, port, 1, bytes);
+}
+
+void BUS_COMMS_RouteUpdateTxCount(uint8_t addr, uint16_t port, uint32 packets, uint32 bytes)
+{
+    CFE_TIME_SysTime_t     now = CFE_TIME_GetTime();
+    BUS_COMMS_RouteSlot_t *slot;
+
+    CFE_ES_PerfLogEntry(BUS_COMMS_ROUTE_UPDATE_PERF_ID);
+    OS_MutSemTake(g_route_mutex);
+
+    slot = BUS_COMMS_RouteFindOrAdd(addr, now);
+    slot->info.tx_count += packets;
+    slot->info.tx_bytes += bytes;
+    slot->info.last_port = port;
+    slot->info.last_seen = now;
+
+    OS_MutSemGive(g_route_mutex);
+
+    CFE_ES_PerfLogExit(BUS_COMMS_ROUTE_UPDATE_PERF_ID);
+}
+
+/* Caller holds g_route_mutex */
+static BUS_COMMS_RouteSlot_t *BUS_COMMS_RouteFind(uint8_t addr)
+{
+    int16 idx;
+
+    for (idx = g_route_buckets[BUS_COMMS_RouteHash(addr)]; idx != BUS_COMMS_ROUTE_NONE; idx = g_routes[idx].next)
+    {
+        if (g_routes[idx].info.addr == addr)
+        {
+            return &g_routes[idx];
+        }
+    }
+
+    return NULL;
+}
+
+uint32 BUS_COMMS_RouteHeartbeatSent(uint8_t addr, uint16 miss_limit)
+{
+    CFE_TIME_SysTime_t     now = CFE_TIME_GetTime();
+    BUS_COMMS_RouteSlot_t *slot;
+    bool                   died;
+    uint32                 missed;
+
+    OS_MutSemTake(g_route_mutex);
+
+    /* Counts as activity, so a silent peer stays listed (as dead) rather than aging out */
+    slot = BUS_COMMS_RouteFindOrAdd(addr, now);
+    slot->info.hb_sent++;
+    slot->info.hb_missed++;
+    slot->info.last_seen = now;
+
+    died = !slot->info.dead && slot->info.hb_missed > miss_limit;
+    if (died)
+    {
+        slot->info.dead = true;
+    }
+    missed = slot->info.hb_missed;
+
+    OS_MutSemGive(g_route_mutex);
+
+    if (died)
+    {
+        // Its connections are half open at best; the first send after it revives reconnects
+        BUS_COMMS_ConnCacheInvalidate(addr);
+        CFE_EVS_SendEvent(BUS_COMMS_NODE_DOWN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "BUS_COMMS: node %u lost, %u heartbeats unanswered", (unsigned)addr,
+                          (unsigned)miss_limit + 1);
+    }
+
+    return missed;
+}
+
+void BUS_COMMS_RouteHeartbeatAck(uint8_t addr, uint32 seq, uint32 rtt_usec)
+{
+    BUS_COMMS_RouteSlot_t *slot;
+    bool                   revived = false;
+    uint32                 delta;
+
+    OS_MutSemTake(g_route_mutex);
+
+    slot = BUS_COMMS_RouteFind(addr);
+
+    /* Late or duplicated echoes say nothing new about the link */
+    if (slot != NULL && (slot->info.hb_acked == 0 || (int32)(seq - slot->info.hb_last_seq) > 0))
+    {
+        if (slot->info.hb_acked == 0)
+        {
+            slot->info.rtt_usec = rtt_usec;
+        }
+        else
+        {
+            /* RFC 6298 smoothing: deviation moves 1/4 and RTT 1/8 toward each sample */
+            delta = (rtt_usec > slot->info.rtt_usec) ? (rtt_usec - slot->info.rtt_usec)
+                                                      : (slot->info.rtt_usec - rtt_usec);
+            slot->info.jitter_usec = (3 * slot->info.jitter_usec + delta) / 4;
+            slot->info.rtt_usec    = (7 * slot->info.rtt_usec + rtt_usec) / 8;
+        }
+
+        slot->info.hb_acked++;
+        slot->info.hb_last_seq = seq;
+        slot->info.hb_missed   = 0;
+
+        revived         = slot->info.dead;
+        slot->info.dead = false;
+    }
+
+    OS_MutSemGive(g_route_mutex);
+
+    if (revived)
+    {
+        CFE_EVS_SendEvent(BUS_COMMS_NODE_UP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "BUS_COMMS: node %u answering again, rtt=%lu us", (unsigned)addr, (unsigned long)rtt_usec);
+    }
+}
+
+bool BUS_COMMS_RouteIsDead(uint8_t addr)
+{
+    BUS_COMMS_RouteSlot_t *slot;
+    bool                   dead;
+
+    OS_MutSemTake(g_route_mutex);
+    slot = BUS_COMMS_RouteFind(addr);
+    dead = (slot != NULL && slot->info.dead);
+    OS_MutSemGive(g_route_mutex);
+
+    return dead;
+}
+
+void BUS_COMMS_RouteAge(void)
+{
+    CFE_TIME_SysTime_t now = CFE_TIME_GetTime();
+    OS_time_t          sample;
+    int64              elapsed_ms;
+
+    OS_GetLocalTime(&sample);
+    elapsed_ms = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(sample, g_route_last_sample));
+
+    OS_MutSemTake(g_route_mutex);
+
+    for (int16 i = 0; i < BUS_COMMS_MAX_ROUTES; ++i)
+    {
+        BUS_COMMS_RouteSlot_t *slot = &g_routes[i];
+
+        if (!slot->in_use)
+        {
+            continue;
+        }
+
+        if (CFE_TIME_Compare(now, slot->info.last_seen) == CFE_TIME_A_GT_B &&
+            CFE_TIME_Subtract(now, slot->info.last_seen).Seconds > BUS_COMMS_ROUTE_MAX_AGE_SEC)
+        {
+            BUS_COMMS_RouteUnlink(i);
+            continue;
+        }
+
+        if (elapsed_ms > 0)
+        {
+            /* Exponentially weighted: each new sample contributes a quarter */
+            uint32 rx_now = (uint32)(((int64)(slot->info.rx_bytes - slot->rx_bytes_sampled) * 1000) / elapsed_ms);
+            uint32 tx_now = (uint32)(((int64)(slot->info.tx_bytes - slot->tx_bytes_sampled) * 1000) / elapsed_ms);
+
+            slot->info.rx_rate     = (3 * slot->info.rx_rate + rx_now) / 4;
+            slot->info.tx_rate     = (3 * slot->info.tx_rate + tx_now) / 4;
+            slot->rx_bytes_sampled = slot->info.rx_bytes;
+            slot->tx_bytes_sampled = slot->info.tx_bytes;
+        }
+
+        if (slot->info.hb_sent != slot->hb_sent_sampled)
+        {
+            uint32 sent  = slot->info.hb_sent - slot->hb_sent_sampled;
+            uint32 acked = slot->info.hb_acked - slot->hb_acked_sampled;
+            uint32 loss  = (acked >= sent) ? 0 : ((sent - acked) * 100) / sent;
+
+            slot->info.loss_pct    = (3 * slot->info.loss_pct + loss) / 4;
+            slot->hb_sent_sampled  = slot->info.hb_sent;
+            slot->hb_acked_sampled = slot->info.hb_acked;
+        }
+    }
+
+    OS_MutSemGive(g_route_mutex);
+
+    if (elapsed_ms > 0)
+    {
+        g_route_last_sample = sample;
+    }
+}
+
+/* Copy up to 'max' entries into 'out' in telemetry format; returns the count copied */
+static uint32 BUS_COMMS_RouteCollect(BUS_COMMS_RouteTlmEntry_t *out, uint32 max)
+{
+    uint32 count = 0;
+
+    OS_MutSemTake(g_route_mutex);
+
+    for (int16 i = 0; i < BUS_COMMS_MAX_ROUTES && count < max; ++i)
+    {
+        const bus_comms_route_entry_t *info = &g_routes[i].info;
+
+        if (!g_routes[i].in_use)
+        {
+            continue;
+        }
+
+        out[count].Addr       = info->addr;
+        out[count].Dead       = info->dead;
+        out[count].LastPort   = info->last_port;
+        out[count].RxCount    = info->rx_count;
+        out[count].TxCount    = info->tx_count;
+        out[count].RxBytes    = info->rx_bytes;
+        out[count].TxBytes    = info->tx_bytes;
+        out[count].RxRate     = info->rx_rate;
+        out[count].TxRate     = info->tx_rate;
+        out[count].LastSeen   = info->last_seen;
+        out[count].RttUsec    = info->rtt_usec;
+        out[count].JitterUsec = info->jitter_usec;
+        out[count].LossPct    = info->loss_pct;
+        ++count;
+    }
+
+    OS_MutSemGive(g_route_mutex);
+
+    return count;
+}
+
+void BUS_COMMS_RouteSendTlm(void)
+{
+    uint32 total = BUS_COMMS_RouteCollect(g_route_tlm_entries, BUS_COMMS_MAX_ROUTES);
+    uint32 first = 0;
+
+    /* An empty table still produces one packet so ground sees the count */
+    do
+    {
+        uint32 n = total - first;
+
+        if (n > BUS_COMMS_ROUTE_TLM_ENTRIES)
+        {
+            n = BUS_COMMS_ROUTE_TLM_ENTRIES;
+        }
+
+        g_route_tlm.Payload.TotalEntries = (uint16)total;
+        g_route_tlm.Payload.FirstIndex   = (uint16)first;
+        g_route_tlm.Payload.EntryCount   = (uint16)n;
+        memcpy(g_route_tlm.Payload.Entries, &g_route_tlm_entries[first], n * sizeof(BUS_COMMS_RouteTlmEntry_t));
+        memset(&g_route_tlm.Payload.Entries[n], 0, (BUS_COMMS_ROUTE_TLM_ENTRIES - n) * sizeof(BUS_COMMS_RouteTlmEntry_t));
+
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(g_route_tlm.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(g_route_tlm.TelemetryHeader), true);
+
+        first += n;
+    } while (first < total);
+}
+
+/* Runs in the ES background file task; hands over a page of entries per call */
+static bool BUS_COMMS_RouteFileGetData(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    BUS_COMMS_RouteFileState_t *State = (BUS_COMMS_RouteFileState_t *)Meta;
+    uint32                      first = RecordNum * BUS_COMMS_ROUTE_TLM_ENTRIES;
+    uint32                      n     = 0;
+
+    if (first < State->EntryCount)
+    {
+        n = State->EntryCount - first;
+        if (n > BUS_COMMS_ROUTE_TLM_ENTRIES)
+        {
+            n = BUS_COMMS_ROUTE_TLM_ENTRIES;
+        }
+    }
+
+    *Buffer  = &State->Entries[first < State->EntryCount ? first : 0];
+    *BufSize = n * sizeof(BUS_COMMS_RouteTlmEntry_t);
+
+    return (first + n >= State->EntryCount);
+}
+
+static void BUS_COMMS_RouteFileEvent(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
+                                     size_t BlockSize, size_t Position)
+{
+    BUS_COMMS_RouteFileState_t *State = (BUS_COMMS_RouteFileState_t *)Meta;
+
+    /* Not the app's task context, so events carry the saved app ID */
+    switch (Event)
+    {
+        case CFE_FS_FileWriteEvent_COMPLETE:
+            CFE_EVS_SendEventWithAppID(BUS_COMMS_ROUTE_FILE_INF_EID, CFE_EVS_EventType_DEBUG, g_route_app_id,
+                                       "BUS_COMMS: %s written, size=%d, entries=%d", State->FileWrite.FileName,
+                                       (int)Position, (int)State->EntryCount);
+            break;
+
+        case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
+        case CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR:
+            CFE_EVS_SendEventWithAppID(BUS_COMMS_ROUTE_FILE_ERR_EID, CFE_EVS_EventType_ERROR, g_route_app_id,
+                                       "BUS_COMMS: route file %s write error, request=%d, actual=%d",
+                                       State->FileWrite.FileName, (int)BlockSize, (int)Status);
+            break;
+
+        case CFE_FS_FileWriteEvent_CREATE_ERROR:
+            CFE_EVS_SendEventWithAppID(BUS_COMMS_ROUTE_FILE_ERR_EID, CFE_EVS_EventType_ERROR, g_route_app_id,
+                                       "BUS_COMMS: error creating route file %s, stat=0x%x",
+                                       State->FileWrite.FileName, (int)Status);
+            break;
+
+        default:
+            /* unhandled event - ignore */
+            break;
+    }
+}
+
+int32 BUS_COMMS_RouteWriteFile(const char *Filename, size_t FilenameSize)
+{
+    int32 Status;
+
+    /* If a dump is already pending, do not overwrite the current request */
+    if (CFE_FS_BackgroundFileDumpIsPending(&g_route_file.FileWrite))
+    {
+        return CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+
+    memset(&g_route_file, 0, sizeof(g_route_file));
+
+    g_route_file.FileWrite.FileSubType = BUS_COMMS_ROUTE_FILE_SUBTYPE;
+    snprintf(g_route_file.FileWrite.Description, sizeof(g_route_file.FileWrite.Description),
+             "BUS_COMMS Routing Table");
+    g_route_file.FileWrite.GetData = BUS_COMMS_RouteFileGetData;
+    g_route_file.FileWrite.OnEvent = BUS_COMMS_RouteFileEvent;
+
+    /* Snapshot now so the background writer never touches the live table */
+    g_route_file.EntryCount = BUS_COMMS_RouteCollect(g_route_file.Entries, BUS_COMMS_MAX_ROUTES);
+
+    Status = CFE_FS_ParseInputFileNameEx(g_route_file.FileWrite.FileName, Filename,
+                                         sizeof(g_route_file.FileWrite.FileName), FilenameSize,
+                                         BUS_COMMS_ROUTE_DEFAULT_FILENAME,
+                                         CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                         CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_FS_BackgroundFileDumpRequest(&g_route_file.FileWrite);
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        BUS_COMMS_RouteFileEvent(&g_route_file, CFE_FS_FileWriteEvent_CREATE_ERROR, Status, 0, 0, 0);
+    }
+
+    return Status;
+}
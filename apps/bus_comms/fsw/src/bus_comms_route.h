@@ -0,0 +1,79 @@
+/************************************************************************
+ * Bus Communications App - CSP node routing table
+ ************************************************************************/
+#ifndef BUS_COMMS_ROUTE_H
+#define BUS_COMMS_ROUTE_H
+
+#include "cfe.h"
+
+#include <stdint.h>
+
+/*
+ * Capacity of the node table.  Entries are found through a hash on the CSP
+ * address; when the table is full the entry seen least recently is evicted,
+ * and entries not seen for BUS_COMMS_ROUTE_MAX_AGE_SEC are dropped by
+ * BUS_COMMS_RouteAge().
+ */
+#ifndef BUS_COMMS_MAX_ROUTES
+#define BUS_COMMS_MAX_ROUTES 32
+#endif
+
+/* Must be a power of two */
+#define BUS_COMMS_ROUTE_HASH_BUCKETS 64
+
+#define BUS_COMMS_ROUTE_MAX_AGE_SEC 300
+
+/* Route table dump file: default name and FS header subtype */
+#define BUS_COMMS_ROUTE_DEFAULT_FILENAME "bus_comms_routes"
+#define BUS_COMMS_ROUTE_FILE_SUBTYPE     0x42430001
+
+// Routing table entry
+typedef struct {
+    uint8_t addr;
+    uint16_t last_port;
+    uint32_t rx_count;
+    uint32_t tx_count;
+    uint32_t rx_bytes;
+    uint32_t tx_bytes;
+    uint32_t rx_rate;   /* bytes/s, smoothed over BUS_COMMS_RouteAge() calls */
+    uint32_t tx_rate;
+    CFE_TIME_SysTime_t last_seen;
+
+    /* Heartbeat link quality, see bus_comms_hb.h */
+    uint32_t hb_sent;
+    uint32_t hb_acked;
+    uint32_t hb_last_seq;   /* newest echo accepted */
+    uint32_t hb_missed;     /* heartbeats sent since the last echo */
+    uint32_t rtt_usec;      /* smoothed round trip */
+    uint32_t jitter_usec;   /* smoothed deviation of samples from rtt_usec */
+    uint32_t loss_pct;      /* smoothed over BUS_COMMS_RouteAge() calls */
+    bool     dead;
+} bus_comms_route_entry_t;
+
+int32 BUS_COMMS_RouteInit(void);
+
+void BUS_COMMS_RouteUpdateRx(uint8_t addr, uint16_t port, uint16_t bytes);
+void BUS_COMMS_RouteUpdateTx(uint8_t addr, uint16_t port, uint16_t bytes);
+
+/* Account a run of 'packets' sends to one node with a single table update */
+void BUS_COMMS_RouteUpdateTxCount(uint8_t addr, uint16_t port, uint32 packets, uint32 bytes);
+
+/* Heartbeat bookkeeping: a node with more than 'miss_limit' unanswered
+ * heartbeats is marked dead until its next echo.  Returns the number of
+ * heartbeats now unanswered, including this one */
+uint32 BUS_COMMS_RouteHeartbeatSent(uint8_t addr, uint16 miss_limit);
+void BUS_COMMS_RouteHeartbeatAck(uint8_t addr, uint32 seq, uint32 rtt_usec);
+
+/* True while heartbeats to 'addr' go unanswered; unknown nodes are alive */
+bool BUS_COMMS_RouteIsDead(uint8_t addr);
+
+/* Refresh rate estimates and evict entries past the age limit */
+void BUS_COMMS_RouteAge(void);
+
+/* Publish the whole table on BUS_COMMS_ROUTE_TLM_MID */
+void BUS_COMMS_RouteSendTlm(void);
+
+/* Queue a dump of the table to a file through the ES background writer */
+int32 BUS_COMMS_RouteWriteFile(const char *Filename, size_t FilenameSize);
+
+#endif /* BUS_COMMS_ROUTE_H */
@@ -0,0 +1,95 @@
+/************************************************************************
+ * Bus Communications App - periodic sends
+ ************************************************************************/
+
+#include "bus_comms_app.h"
+#include "bus_comms_sched.h"
+#include "bus_comms_buf.h"
+#include "bus_comms_txq.h"
+
+#include <string.h>
+
+#include "osapi.h"
+
+typedef struct
+{
+    BUS_COMMS_ScheduleEntry_t cfg;
+    OS_time_t                 next_due;
+} BUS_COMMS_SchedSlot_t;
+
+static BUS_COMMS_SchedSlot_t g_sched[BUS_COMMS_MAX_SCHEDULES];
+static osal_id_t             g_sched_mutex;
+
+int32 BUS_COMMS_SchedInit(void)
+{
+    memset(g_sched, 0, sizeof(g_sched));
+
+    return OS_MutSemCreate(&g_sched_mutex, "BC_SCHED_MUT", 0);
+}
+
+void BUS_COMMS_SchedLoad(const BUS_COMMS_ScheduleEntry_t *entries, uint8_t peer_addr)
+{
+    OS_time_t now;
+
+    OS_GetLocalTime(&now);
+    OS_MutSemTake(g_sched_mutex);
+
+    for (size_t i = 0; i < BUS_COMMS_MAX_SCHEDULES; ++i)
+    {
+        g_sched[i].cfg      = entries[i];
+        g_sched[i].next_due = now;
+
+        if (g_sched[i].cfg.dest == BUS_COMMS_ADDR_PEER)
+        {
+            g_sched[i].cfg.dest = peer_addr;
+        }
+    }
+
+    OS_MutSemGive(g_sched_mutex);
+}
+
+uint32 BUS_COMMS_SchedRun(void)
+{
+    OS_time_t     now;
+    int64         remaining;
+    uint32        wait_ms = BUS_COMMS_SCHED_IDLE_MSEC;
+    csp_packet_t *packet;
+
+    OS_GetLocalTime(&now);
+    OS_MutSemTake(g_sched_mutex);
+
+    for (size_t i = 0; i < BUS_COMMS_MAX_SCHEDULES; ++i)
+    {
+        BUS_COMMS_SchedSlot_t *s = &g_sched[i];
+
+        if (!s->cfg.InUse)
+        {
+            continue;
+        }
+
+        remaining = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(s->next_due, now));
+        if (remaining <= 0)
+        {
+            packet = BUS_COMMS_BufGet(s->cfg.len, 0);
+            /* A missing buffer is counted in CspBufAllocFails; the next period tries again */
+            if (packet != NULL)
+            {
+                memcpy(packet->data, s->cfg.data, s->cfg.len);
+                packet->length = s->cfg.len;
+                BUS_COMMS_TxqPush(s->cfg.prio, s->cfg.dest, s->cfg.port, BUS_COMMS_PORT_MODE_CONN, packet);
+            }
+
+            s->next_due = OS_TimeAdd(now, OS_TimeFromTotalMilliseconds(s->cfg.PeriodMsec));
+            remaining   = s->cfg.PeriodMsec;
+        }
+
+        if (remaining < wait_ms)
+        {
+            wait_ms = (uint32)remaining;
+        }
+    }
+
+    OS_MutSemGive(g_sched_mutex);
+
+    return wait_ms;
+}
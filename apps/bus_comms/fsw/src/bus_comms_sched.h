@@ -0,0 +1,24 @@
+/************************************************************************
+ * Bus Communications App - periodic sends
+ ************************************************************************/
+#ifndef BUS_COMMS_SCHED_H
+#define BUS_COMMS_SCHED_H
+
+#include "cfe.h"
+
+#include <stdint.h>
+
+#include "bus_comms_table.h"
+
+/* Longest the TX task sleeps when no schedule entry is enabled */
+#define BUS_COMMS_SCHED_IDLE_MSEC 1000
+
+int32 BUS_COMMS_SchedInit(void);
+
+/* Replace the active schedule; every entry first fires on the next run */
+void BUS_COMMS_SchedLoad(const BUS_COMMS_ScheduleEntry_t *entries, uint8_t peer_addr);
+
+/* Queue the entries that are due and return the msec until the next one */
+uint32 BUS_COMMS_SchedRun(void);
+
+#endif /* BUS_COMMS_SCHED_H */
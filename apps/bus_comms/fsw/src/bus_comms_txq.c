@@ -0,0 +1,474 @@
+/************************************************************************
+ * Bus Communications App - CSP transmit queue
+ ************************************************************************/
+
+#include "bus_comms_app.h"
+#include "bus_comms_txq.h"
+#include "bus_comms_conn.h"
+#include "bus_comms_route.h"
+#include "bus_comms_event.h"
+#include "bus_comms_events.h"
+
+#include <string.h>
+
+#include "osapi.h"
+
+typedef struct
+{
+    csp_packet_t *packet;
+    uint8_t       dest;
+    uint8_t       port;
+    uint8_t       prio;
+    uint8_t       mode;
+    bool          report;    /* publish a completion, see BUS_COMMS_TxqPushCmd */
+    bool          expired;   /* budget ran out while queued */
+    bool          throttled; /* counted in TxThrottled once */
+    uint16        tag;
+    uint32        budget_ms; /* 0 = no limit */
+    OS_time_t     queued;
+} BUS_COMMS_TxqEntry_t;
+
+typedef struct
+{
+    BUS_COMMS_TxqEntry_t entries[BUS_COMMS_TXQ_LANE_DEPTH];
+    uint32               count;
+} BUS_COMMS_TxqLane_t;
+
+typedef struct
+{
+    int32     tokens; /* bytes; negative after a packet larger than the balance */
+    uint32    rate;
+    uint32    burst;
+    OS_time_t last_refill;
+} BUS_COMMS_TxqBucket_t;
+
+static BUS_COMMS_TxqLane_t   g_txq_lanes[BUS_COMMS_TXQ_LANES];
+static BUS_COMMS_TxqBucket_t g_txq_buckets[256];
+static osal_id_t             g_txq_mutex;
+static osal_id_t             g_txq_wakeup;
+static osal_id_t             g_txq_space;
+static uint32                g_txq_depth = BUS_COMMS_TXQ_LANE_DEPTH;
+static uint32                g_txq_cmd_budget;
+
+/* Owned by the TX task */
+static BUS_COMMS_SendStatusTlm_t g_txq_status_tlm;
+
+static const char *const g_txq_status_text[] = {"sent", "connect failed", "timed out", "node dead"};
+
+static void BUS_COMMS_TxqBucketReset(BUS_COMMS_TxqBucket_t *b, uint32 rate, uint32 burst)
+{
+    if (burst > INT32_MAX)
+    {
+        burst = INT32_MAX;
+    }
+
+    b->rate   = rate;
+    b->burst  = burst;
+    b->tokens = (int32)burst;
+    OS_GetLocalTime(&b->last_refill);
+}
+
+/* Refill the bucket of 'dest' and take 'len' bytes if any tokens are left.
+ * On refusal *wait_ms is lowered to the time until the balance turns positive. */
+static bool BUS_COMMS_TxqTakeTokens(uint8_t dest, uint16_t len, OS_time_t now, uint32 *wait_ms)
+{
+    BUS_COMMS_TxqBucket_t *b = &g_txq_buckets[dest];
+    int64                  elapsed;
+    int64                  credited;
+    uint32                 wait;
+
+    if (b->rate == 0)
+    {
+        return true;
+    }
+
+    elapsed = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(now, b->last_refill));
+    if (elapsed > 0)
+    {
+        credited = (elapsed * b->rate) / 1000;
+        if (b->tokens + credited >= (int64)b->burst)
+        {
+            /* A full bucket banks nothing, so idle time cannot add a second burst */
+            b->tokens      = (int32)b->burst;
+            b->last_refill = now;
+        }
+        else if (credited > 0)
+        {
+            /* Advance by exactly the credited time so slow rates keep the remainder */
+            b->tokens += (int32)credited;
+            b->last_refill =
+                OS_TimeAdd(b->last_refill, OS_TimeFromTotalMilliseconds((credited * 1000) / b->rate));
+        }
+    }
+
+    if (b->tokens > 0)
+    {
+        b->tokens -= len;
+        return true;
+    }
+
+    wait = (uint32)(((int64)1 - b->tokens) * 1000 / b->rate) + 1;
+    if (wait < *wait_ms)
+    {
+        *wait_ms = wait;
+    }
+
+    return false;
+}
+
+/* Milliseconds of budget left, 0 once spent; entries without a budget get 'unlimited' */
+static uint32 BUS_COMMS_TxqBudgetLeft(const BUS_COMMS_TxqEntry_t *e, OS_time_t now, uint32 unlimited)
+{
+    int64 elapsed;
+
+    if (e->budget_ms == 0)
+    {
+        return unlimited;
+    }
+
+    elapsed = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(now, e->queued));
+
+    return (elapsed >= e->budget_ms) ? 0 : (uint32)(e->budget_ms - elapsed);
+}
+
+/* Report the outcome of a BUS_COMMS_TxqPushCmd send.  TX task only. */
+static void BUS_COMMS_TxqComplete(const BUS_COMMS_TxqEntry_t *e, uint8 status)
+{
+    OS_time_t now;
+    uint32    msec;
+
+    if (!e->report)
+    {
+        return;
+    }
+
+    OS_GetLocalTime(&now);
+    msec = (uint32)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(now, e->queued));
+
+    g_txq_status_tlm.Payload.Tag         = e->tag;
+    g_txq_status_tlm.Payload.Dest        = e->dest;
+    g_txq_status_tlm.Payload.Port        = e->port;
+    g_txq_status_tlm.Payload.Status      = status;
+    g_txq_status_tlm.Payload.ElapsedMsec = msec;
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(g_txq_status_tlm.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(g_txq_status_tlm.TelemetryHeader), true);
+
+    if (status != BUS_COMMS_SEND_OK)
+    {
+        BUS_COMMS_ErrEvent(BUS_COMMS_SEND_ERR_EID, "BUS_COMMS: send tag %u to %u:%u %s after %lu ms",
+                           (unsigned)e->tag, (unsigned)e->dest, (unsigned)e->port, g_txq_status_text[status],
+                           (unsigned long)msec);
+    }
+}
+
+/* Move up to BUS_COMMS_TXQ_MAX_BURST sendable or expired entries into
+ * 'batch', highest priority lane first.  Returns the number taken. */
+static uint32 BUS_COMMS_TxqCollectLocked(BUS_COMMS_TxqEntry_t *batch, uint32 *wait_ms)
+{
+    OS_time_t now;
+    uint32    n = 0;
+
+    OS_GetLocalTime(&now);
+
+    for (uint32 lane = 0; lane < BUS_COMMS_TXQ_LANES && n < BUS_COMMS_TXQ_MAX_BURST; ++lane)
+    {
+        BUS_COMMS_TxqLane_t *l = &g_txq_lanes[lane];
+        uint32               i = 0;
+
+        while (i < l->count && n < BUS_COMMS_TXQ_MAX_BURST)
+        {
+            BUS_COMMS_TxqEntry_t *e    = &l->entries[i];
+            uint32                left = BUS_COMMS_TxqBudgetLeft(e, now, UINT32_MAX);
+
+            e->expired = (left == 0);
+
+            if (!e->expired && !BUS_COMMS_TxqTakeTokens(e->dest, e->packet->length, now, wait_ms))
+            {
+                // Each pass refuses it again; count the packet, not the passes
+                if (!e->throttled)
+                {
+                    e->throttled = true;
+                    BUS_COMMS_STAT_INC(TxThrottled);
+                }
+
+                // Wake up in time to expire it if it is still throttled then
+                if (left < *wait_ms)
+                {
+                    *wait_ms = left;
+                }
+                ++i;
+                continue;
+            }
+
+            batch[n++] = *e;
+            --l->count;
+            memmove(e, e + 1, (l->count - i) * sizeof(*e));
+        }
+    }
+
+    return n;
+}
+
+/* Consecutive entries to the same dest:port:prio share one connection
+ * lookup and one routing table update.  Runs with no lock held, so a slow
+ * connect or a send blocked on the bus only delays the TX task itself. */
+static void BUS_COMMS_TxqSend(const BUS_COMMS_TxqEntry_t *batch, uint32 count)
+{
+    const BUS_COMMS_TxqEntry_t *run         = NULL;
+    csp_conn_t                 *conn        = NULL;
+    uint32                      run_packets = 0;
+    uint32                      run_bytes   = 0;
+    bool                        dead        = false;
+    OS_time_t                   now;
+
+    for (uint32 i = 0; i < count; ++i)
+    {
+        const BUS_COMMS_TxqEntry_t *e = &batch[i];
+
+        if (e->expired)
+        {
+            BUS_COMMS_STAT_INC(TxTimeouts);
+            csp_buffer_free(e->packet);
+            BUS_COMMS_TxqComplete(e, BUS_COMMS_SEND_TIMEOUT);
+            continue;
+        }
+
+        if (e->mode == BUS_COMMS_PORT_MODE_DGRAM)
+        {
+            BUS_COMMS_CSP_SendDatagram(e->prio, e->dest, e->port, e->packet);
+            BUS_COMMS_TxqComplete(e, BUS_COMMS_SEND_OK);
+            continue;
+        }
+
+        if (run == NULL || e->dest != run->dest || e->port != run->port || e->prio != run->prio)
+        {
+            if (run_packets > 0)
+            {
+                BUS_COMMS_RouteUpdateTxCount(run->dest, run->port, run_packets, run_bytes);
+                run_packets = 0;
+                run_bytes   = 0;
+            }
+
+            // Dead nodes are skipped instead of waiting out a connect timeout, and a connect
+            // may use at most what is left of the packet's budget; a failed connect is not
+            // retried for the rest of this run, and the node's other cached connections are
+            // dropped since they are unlikely to be any better
+            OS_GetLocalTime(&now);
+            dead = BUS_COMMS_RouteIsDead(e->dest);
+            conn = dead ? NULL
+                        : BUS_COMMS_ConnGet(e->prio, e->dest, e->port,
+                                                  BUS_COMMS_TxqBudgetLeft(e, now, BUS_COMMS_CONN_CONNECT_TIMEOUT));
+            run  = e;
+
+            if (conn == NULL && !dead)
+            {
+                BUS_COMMS_ConnCacheInvalidate(e->dest);
+            }
+        }
+
+        if (conn == NULL)
+        {
+            if (dead)
+            {
+                BUS_COMMS_STAT_INC(TxDeadDrops);
+            }
+            else
+            {
+                BUS_COMMS_STAT_INC(TxConnErrors);
+            }
+            csp_buffer_free(e->packet);
+            BUS_COMMS_TxqComplete(e, dead ? BUS_COMMS_SEND_DEAD_NODE : BUS_COMMS_SEND_CONN_FAILED);
+            continue;
+        }
+
+        run_packets++;
+        run_bytes += e->packet->length;
+        csp_send(conn, e->packet);
+        BUS_COMMS_TxqComplete(e, BUS_COMMS_SEND_OK);
+    }
+
+    if (run_packets > 0)
+    {
+        BUS_COMMS_RouteUpdateTxCount(run->dest, run->port, run_packets, run_bytes);
+    }
+
+}
+
+int32 BUS_COMMS_TxqInit(void)
+{
+    int32 status;
+
+    memset(g_txq_lanes, 0, sizeof(g_txq_lanes));
+
+    for (uint32 i = 0; i < 256; ++i)
+    {
+        BUS_COMMS_TxqBucketReset(&g_txq_buckets[i], BUS_COMMS_TXQ_DEFAULT_RATE, BUS_COMMS_TXQ_DEFAULT_BURST);
+    }
+
+    CFE_MSG_Init(CFE_MSG_PTR(g_txq_status_tlm.TelemetryHeader), CFE_SB_ValueToMsgId(BUS_COMMS_SEND_STATUS_TLM_MID),
+                 sizeof(g_txq_status_tlm));
+
+    status = OS_MutSemCreate(&g_txq_mutex, "BC_TXQ_MUT", 0);
+    if (status == OS_SUCCESS)
+    {
+        status = OS_BinSemCreate(&g_txq_wakeup, "BC_TXQ_SEM", 0, 0);
+    }
+    if (status == OS_SUCCESS)
+    {
+        status = OS_BinSemCreate(&g_txq_space, "BC_TXQ_SPACE", 0, 0);
+    }
+
+    return status;
+}
+
+/* Append to the lane for 'prio' if it has room; the caller holds the mutex */
+static bool BUS_COMMS_TxqAppendLocked(const BUS_COMMS_TxqEntry_t *e)
+{
+    BUS_COMMS_TxqLane_t *l = &g_txq_lanes[e->prio];
+
+    if (l->count >= g_txq_depth)
+    {
+        return false;
+    }
+
+    l->entries[l->count++] = *e;
+
+    return true;
+}
+
+int BUS_COMMS_TxqPush(uint8_t prio, uint8_t dest, uint8_t port, uint8_t mode, csp_packet_t *packet)
+{
+    return BUS_COMMS_TxqPushWait(prio, dest, port, mode, packet, 0);
+}
+
+static int BUS_COMMS_TxqPushEntry(BUS_COMMS_TxqEntry_t *e, uint32 timeout_ms)
+{
+    OS_time_t deadline;
+    OS_time_t now;
+    int64     remaining = 0;
+    bool      queued;
+
+    if (e->prio >= BUS_COMMS_TXQ_LANES)
+    {
+        e->prio = BUS_COMMS_TXQ_LANES - 1;
+    }
+
+    OS_GetLocalTime(&e->queued);
+    deadline = OS_TimeAdd(e->queued, OS_TimeFromTotalMilliseconds(timeout_ms));
+
+    for (;;)
+    {
+        OS_MutSemTake(g_txq_mutex);
+        if (e->report)
+        {
+            e->budget_ms = g_txq_cmd_budget;
+        }
+        queued = BUS_COMMS_TxqAppendLocked(e);
+        OS_MutSemGive(g_txq_mutex);
+
+        if (queued)
+        {
+            break;
+        }
+
+        if (timeout_ms > 0)
+        {
+            OS_GetLocalTime(&now);
+            remaining = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(deadline, now));
+        }
+
+        if (remaining <= 0)
+        {
+            BUS_COMMS_STAT_INC(TxQueueFull);
+            csp_buffer_free(e->packet);
+            return -1;
+        }
+
+        // Woken by the TX task after each pass that made room
+        OS_BinSemTimedWait(g_txq_space, (uint32)remaining);
+    }
+
+    BUS_COMMS_STAT_INC(TxQueued);
+    OS_BinSemGive(g_txq_wakeup);
+
+    return 0;
+}
+
+int BUS_COMMS_TxqPushWait(uint8_t prio, uint8_t dest, uint8_t port, uint8_t mode, csp_packet_t *packet,
+                          uint32 timeout_ms)
+{
+    BUS_COMMS_TxqEntry_t e = {.packet = packet, .dest = dest, .port = port, .prio = prio, .mode = mode};
+
+    return BUS_COMMS_TxqPushEntry(&e, timeout_ms);
+}
+
+int BUS_COMMS_TxqPushCmd(uint8_t prio, uint8_t dest, uint8_t port, csp_packet_t *packet, uint16 tag)
+{
+    BUS_COMMS_TxqEntry_t e = {.packet = packet,
+                              .dest   = dest,
+                              .port   = port,
+                              .prio   = prio,
+                              .mode   = BUS_COMMS_PORT_MODE_CONN,
+                              .report = true,
+                              .tag    = tag};
+
+    return BUS_COMMS_TxqPushEntry(&e, 0);
+}
+
+void BUS_COMMS_TxqService(uint32 max_wait_ms)
+{
+    BUS_COMMS_TxqEntry_t batch[BUS_COMMS_TXQ_MAX_BURST];
+    uint32               wait_ms = max_wait_ms;
+    uint32               count;
+
+    OS_MutSemTake(g_txq_mutex);
+    count = BUS_COMMS_TxqCollectLocked(batch, &wait_ms);
+    OS_MutSemGive(g_txq_mutex);
+
+    if (count == 0)
+    {
+        // Nothing sendable: sleep until a push, a bucket refill or the caller's deadline
+        if (wait_ms > 0)
+        {
+            OS_BinSemTimedWait(g_txq_wakeup, wait_ms);
+        }
+        return;
+    }
+
+    OS_BinSemGive(g_txq_space);
+    CFE_ES_PerfLogEntry(BUS_COMMS_TX_PERF_ID);
+    BUS_COMMS_TxqSend(batch, count);
+    CFE_ES_PerfLogExit(BUS_COMMS_TX_PERF_ID);
+}
+
+void BUS_COMMS_TxqWake(void)
+{
+    OS_BinSemGive(g_txq_wakeup);
+}
+
+void BUS_COMMS_TxqSetDepth(uint32 depth)
+{
+    if (depth == 0 || depth > BUS_COMMS_TXQ_LANE_DEPTH)
+    {
+        depth = BUS_COMMS_TXQ_LANE_DEPTH;
+    }
+
+    OS_MutSemTake(g_txq_mutex);
+    g_txq_depth = depth;
+    OS_MutSemGive(g_txq_mutex);
+}
+
+void BUS_COMMS_TxqSetCmdBudget(uint32 budget_ms)
+{
+    OS_MutSemTake(g_txq_mutex);
+    g_txq_cmd_budget = budget_ms;
+    OS_MutSemGive(g_txq_mutex);
+}
+
+void BUS_COMMS_TxqSetRate(uint8_t dest, uint32 bytes_per_sec, uint32 burst)
+{
+    OS_MutSemTake(g_txq_mutex);
+    BUS_COMMS_TxqBucketReset(&g_txq_buckets[dest], bytes_per_sec, burst);
+    OS_MutSemGive(g_txq_mutex);
+}
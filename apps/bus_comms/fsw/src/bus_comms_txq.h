@@ -0,0 +1,70 @@
+/************************************************************************
+ * Bus Communications App - CSP transmit queue
+ ************************************************************************/
+#ifndef BUS_COMMS_TXQ_H
+#define BUS_COMMS_TXQ_H
+
+#include "cfe.h"
+
+#include <stdint.h>
+
+#include <csp/csp.h>
+
+/*
+ * Outgoing packets are queued in one lane per CSP priority and sent by the
+ * TX child task, so command handling never waits on csp_connect or a busy
+ * CAN bus.  Lanes are served strictly in priority order.  Each destination
+ * has a token bucket refilled at its configured rate; a packet whose
+ * destination has run out of tokens stays queued, keeping its place
+ * behind earlier packets to the same node, while packets to other nodes
+ * go ahead.  Packets from commands carry a time budget and are dropped
+ * and reported once it is spent, so a dead peer delays nothing but its
+ * own traffic.
+ */
+#define BUS_COMMS_TXQ_LANES      4 /* CSP_PRIO_CRITICAL .. CSP_PRIO_LOW */
+#define BUS_COMMS_TXQ_LANE_DEPTH 32
+
+/* Packets sent per service pass, bounding the time the conn cache is held */
+#define BUS_COMMS_TXQ_MAX_BURST 16
+
+/* Default per-destination limit: sustained bytes/s (0 = unlimited) and burst */
+#define BUS_COMMS_TXQ_DEFAULT_RATE  32000
+#define BUS_COMMS_TXQ_DEFAULT_BURST 2048
+
+int32 BUS_COMMS_TxqInit(void);
+
+/* Queue a packet for 'dest'.  Ownership of 'packet' always passes to this
+ * function; returns 0 if queued, -1 if the lane is full. */
+int BUS_COMMS_TxqPush(uint8_t prio, uint8_t dest, uint8_t port, uint8_t mode, csp_packet_t *packet);
+
+/* As BUS_COMMS_TxqPush, but wait up to 'timeout_ms' for room in the lane.
+ * For producers that may block, never the command pipe. */
+int BUS_COMMS_TxqPushWait(uint8_t prio, uint8_t dest, uint8_t port, uint8_t mode, csp_packet_t *packet,
+                          uint32 timeout_ms);
+
+/* Queue a connection-mode send on behalf of a command, without waiting.
+ * The packet must leave within the configured command budget (see
+ * BUS_COMMS_TxqSetCmdBudget), including any csp_connect, or it is dropped;
+ * the outcome is published in BUS_COMMS_SendStatusTlm_t under 'tag', and
+ * failures also raise BUS_COMMS_SEND_ERR_EID.  Ownership of 'packet'
+ * always passes; returns 0 if queued, -1 if the lane is full. */
+int BUS_COMMS_TxqPushCmd(uint8_t prio, uint8_t dest, uint8_t port, csp_packet_t *packet, uint16 tag);
+
+/* Send whatever the rate limits allow, waiting up to 'max_wait_ms' for
+ * work when nothing is ready.  Called from the TX child task only. */
+void BUS_COMMS_TxqService(uint32 max_wait_ms);
+
+/* Cut short the TX task's wait in BUS_COMMS_TxqService, e.g. at shutdown */
+void BUS_COMMS_TxqWake(void);
+
+/* Limit every lane to 'depth' entries (at most BUS_COMMS_TXQ_LANE_DEPTH);
+ * packets already queued beyond it are still sent */
+void BUS_COMMS_TxqSetDepth(uint32 depth);
+
+/* Budget for packets queued from now on by BUS_COMMS_TxqPushCmd; 0 = no limit */
+void BUS_COMMS_TxqSetCmdBudget(uint32 budget_ms);
+
+/* Change the rate limit of one destination */
+void BUS_COMMS_TxqSetRate(uint8_t dest, uint32 bytes_per_sec, uint32 burst);
+
+#endif /* BUS_COMMS_TXQ_H */
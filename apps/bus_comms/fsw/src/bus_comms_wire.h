@@ -0,0 +1,44 @@
+/************************************************************************
+ * Bus Communications App - network byte order helpers
+ ************************************************************************/
+#ifndef BUS_COMMS_WIRE_H
+#define BUS_COMMS_WIRE_H
+
+#include "common_types.h"
+
+/* Protocol headers are packed big-endian byte by byte, never through structs */
+
+static inline void BUS_COMMS_Put16(uint8 *p, uint16 v)
+{
+    p[0] = (uint8)(v >> 8);
+    p[1] = (uint8)v;
+}
+
+static inline void BUS_COMMS_Put32(uint8 *p, uint32 v)
+{
+    BUS_COMMS_Put16(&p[0], (uint16)(v >> 16));
+    BUS_COMMS_Put16(&p[2], (uint16)v);
+}
+
+static inline void BUS_COMMS_Put64(uint8 *p, uint64 v)
+{
+    BUS_COMMS_Put32(&p[0], (uint32)(v >> 32));
+    BUS_COMMS_Put32(&p[4], (uint32)v);
+}
+
+static inline uint16 BUS_COMMS_Get16(const uint8 *p)
+{
+    return (uint16)((p[0] << 8) | p[1]);
+}
+
+static inline uint32 BUS_COMMS_Get32(const uint8 *p)
+{
+    return ((uint32)BUS_COMMS_Get16(&p[0]) << 16) | BUS_COMMS_Get16(&p[2]);
+}
+
+static inline uint64 BUS_COMMS_Get64(const uint8 *p)
+{
+    return ((uint64)BUS_COMMS_Get32(&p[0]) << 32) | BUS_COMMS_Get32(&p[4]);
+}
+
+#endif /* BUS_COMMS_WIRE_H */
@@ -0,0 +1,848 @@
+/************************************************************************
+ * Bus Communications App - bulk file transfer
+ ************************************************************************/
+
+#include "bus_comms_app.h"
+#include "bus_comms_xfer.h"
+#include "bus_comms_buf.h"
+#include "bus_comms_events.h"
+#include "bus_comms_route.h"
+#include "bus_comms_txq.h"
+#include "bus_comms_wire.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "osapi.h"
+
+/* Packet types, the first byte of every transfer packet */
+#define BUS_COMMS_XFER_PKT_START  1 /* id, size(4), chunk(2), crc(4), name */
+#define BUS_COMMS_XFER_PKT_DATA   2 /* id, index(4), data */
+#define BUS_COMMS_XFER_PKT_STATUS 3 /* id, code, base(4), high(4), mask(8) */
+#define BUS_COMMS_XFER_PKT_ABORT  4 /* id */
+
+#define BUS_COMMS_XFER_START_LEN    (13 + CFE_MISSION_MAX_PATH_LEN)
+#define BUS_COMMS_XFER_DATA_HDR_LEN 7
+#define BUS_COMMS_XFER_STATUS_LEN   20
+#define BUS_COMMS_XFER_ABORT_LEN    3
+
+/* Status codes */
+#define BUS_COMMS_XFER_ST_PROGRESS  0
+#define BUS_COMMS_XFER_ST_COMPLETE  1
+#define BUS_COMMS_XFER_ST_BUSY      2
+#define BUS_COMMS_XFER_ST_IO_ERROR  3
+#define BUS_COMMS_XFER_ST_CRC_ERROR 4
+#define BUS_COMMS_XFER_ST_REJECTED  5
+
+/* Bulk data yields to everything else on the bus */
+#define BUS_COMMS_XFER_PRIO CSP_PRIO_LOW
+
+/* Receive poll while a send is running, so probes go out on time */
+#define BUS_COMMS_XFER_TX_POLL_MSEC 50
+#define BUS_COMMS_XFER_IDLE_MSEC    BUS_COMMS_STOP_POLL_MSEC
+#define BUS_COMMS_XFER_RX_BURST     32
+
+typedef struct
+{
+    bool      active;
+    bool      started;     /* receiver has answered START */
+    uint8_t   dest;
+    uint16    id;
+    osal_id_t fd;
+    uint32    size;
+    uint32    crc;
+    uint16    chunk;
+    uint32    nchunks;
+    uint32    base;        /* every chunk below has been received */
+    uint32    next;        /* first chunk not yet sent */
+    uint64    retx;        /* bit i: resend chunk base + i */
+    uint32    probes;
+    OS_time_t last_status;
+    OS_time_t start_time;
+    uint32    cache_off;   /* file range held in g_xfer_tx_io */
+    uint32    cache_len;
+    char      dst[CFE_MISSION_MAX_PATH_LEN];
+} BUS_COMMS_XferTx_t;
+
+typedef struct
+{
+    bool      active;
+    uint8_t   src;
+    uint16    id;
+    osal_id_t fd;
+    uint32    size;
+    uint32    crc;
+    uint16    chunk;
+    uint32    nchunks;
+    uint32    received;
+    uint32    base;        /* first missing chunk */
+    uint32    high;        /* one past the highest chunk received */
+    uint32    since_status;
+    OS_time_t last;
+    char      dst[CFE_MISSION_MAX_PATH_LEN];
+    char      tmp[CFE_MISSION_MAX_PATH_LEN];
+    uint8     have[BUS_COMMS_XFER_MAX_CHUNKS / 8];
+} BUS_COMMS_XferRx_t;
+
+/* Send request handed from the command pipe to the transfer task */
+typedef struct
+{
+    bool    pending;
+    bool    abort;
+    uint8_t dest;
+    char    src[CFE_MISSION_MAX_PATH_LEN];
+    char    dst[CFE_MISSION_MAX_PATH_LEN];
+} BUS_COMMS_XferRequest_t;
+
+static BUS_COMMS_XferRequest_t g_xfer_req;
+static osal_id_t               g_xfer_mutex;
+static uint8_t                 g_xfer_port;
+static uint16                  g_xfer_next_id;
+
+/* Everything below is owned by the transfer task */
+static BUS_COMMS_XferTx_t g_xfer_tx;
+static BUS_COMMS_XferRx_t g_xfer_rx;
+static uint8              g_xfer_tx_io[BUS_COMMS_XFER_READ_SIZE];
+static uint8              g_xfer_rx_io[BUS_COMMS_XFER_READ_SIZE];
+
+/* Last completed receive, so a sender that missed COMPLETE can be answered */
+static struct
+{
+    bool    valid;
+    uint8_t src;
+    uint16  id;
+} g_xfer_rx_done;
+
+static bool BUS_COMMS_XferHave(uint32 index)
+{
+    return (g_xfer_rx.have[index / 8] & (1u << (index % 8))) != 0;
+}
+
+static bool BUS_COMMS_XferSend(uint8_t dest, const uint8 *buf, uint16 len)
+{
+    csp_packet_t *packet = BUS_COMMS_BufGet(len, 0);
+
+    if (packet == NULL)
+    {
+        return false;
+    }
+
+    memcpy(packet->data, buf, len);
+    packet->length = len;
+
+    return BUS_COMMS_TxqPushWait(BUS_COMMS_XFER_PRIO, dest, g_xfer_port, BUS_COMMS_PORT_MODE_DGRAM, packet,
+                                 BUS_COMMS_XFER_QUEUE_WAIT_MSEC) == 0;
+}
+
+static void BUS_COMMS_XferSendStatus(uint8_t dest, uint16 id, uint8 code)
+{
+    uint8  buf[BUS_COMMS_XFER_STATUS_LEN];
+    uint64 mask = 0;
+
+    memset(buf, 0, sizeof(buf));
+
+    buf[0] = BUS_COMMS_XFER_PKT_STATUS;
+    BUS_COMMS_Put16(&buf[1], id);
+    buf[3] = code;
+
+    if (g_xfer_rx.active && g_xfer_rx.id == id)
+    {
+        for (uint32 i = 0; i < 64 && g_xfer_rx.base + i < g_xfer_rx.nchunks; ++i)
+        {
+            if (BUS_COMMS_XferHave(g_xfer_rx.base + i))
+            {
+                mask |= (uint64)1 << i;
+            }
+        }
+
+        BUS_COMMS_Put32(&buf[4], g_xfer_rx.base);
+        BUS_COMMS_Put32(&buf[8], g_xfer_rx.high);
+        BUS_COMMS_Put64(&buf[12], mask);
+        g_xfer_rx.since_status = 0;
+    }
+
+    BUS_COMMS_XferSend(dest, buf, sizeof(buf));
+}
+
+/* CRC of the first 'size' bytes of an open file, read in large blocks */
+static bool BUS_COMMS_XferFileCrc(osal_id_t fd, uint32 size, uint8 *io, uint32 *crc)
+{
+    uint32 done = 0;
+    int32  n;
+
+    *crc = 0;
+
+    if (OS_lseek(fd, 0, OS_SEEK_SET) != 0)
+    {
+        return false;
+    }
+
+    while (done < size)
+    {
+        n = OS_read(fd, io, (size - done < BUS_COMMS_XFER_READ_SIZE) ? (size - done) : BUS_COMMS_XFER_READ_SIZE);
+        if (n <= 0)
+        {
+            return false;
+        }
+
+        *crc = CFE_ES_CalculateCRC(io, (size_t)n, *crc, CFE_MISSION_ES_DEFAULT_CRC);
+        done += (uint32)n;
+    }
+
+    return true;
+}
+
+/* ------------------ Sender ------------------ */
+
+static void BUS_COMMS_XferTxEnd(bool success, const char *reason)
+{
+    OS_time_t now;
+    int64     msec;
+
+    OS_GetLocalTime(&now);
+    msec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(now, g_xfer_tx.start_time));
+
+    OS_close(g_xfer_tx.fd);
+    g_xfer_tx.active = false;
+
+    if (success)
+    {
+        BUS_COMMS_STAT_INC(XferTxFiles);
+        BUS_COMMS_STAT_SET(XferLastRate, (uint32)(((uint64)g_xfer_tx.size * 1000) / (uint64)(msec > 0 ? msec : 1)));
+        CFE_EVS_SendEvent(BUS_COMMS_XFER_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "BUS_COMMS: sent %lu bytes to %u:%s in %ld ms", (unsigned long)g_xfer_tx.size,
+                          (unsigned)g_xfer_tx.dest, g_xfer_tx.dst, (long)msec);
+    }
+    else
+    {
+        BUS_COMMS_STAT_INC(XferErrors);
+        CFE_EVS_SendEvent(BUS_COMMS_XFER_ERR_EID, CFE_EVS_EventType_ERROR, "BUS_COMMS: send to %u:%s failed: %s",
+                          (unsigned)g_xfer_tx.dest, g_xfer_tx.dst, reason);
+    }
+}
+
+static bool BUS_COMMS_XferTxSendStart(void)
+{
+    uint8 buf[BUS_COMMS_XFER_START_LEN];
+
+    memset(buf, 0, sizeof(buf));
+
+    buf[0] = BUS_COMMS_XFER_PKT_START;
+    BUS_COMMS_Put16(&buf[1], g_xfer_tx.id);
+    BUS_COMMS_Put32(&buf[3], g_xfer_tx.size);
+    BUS_COMMS_Put16(&buf[7], g_xfer_tx.chunk);
+    BUS_COMMS_Put32(&buf[9], g_xfer_tx.crc);
+    memcpy(&buf[13], g_xfer_tx.dst, sizeof(g_xfer_tx.dst));
+
+    return BUS_COMMS_XferSend(g_xfer_tx.dest, buf, sizeof(buf));
+}
+
+static void BUS_COMMS_XferTxBegin(uint8_t dest, const char *src, const char *dst)
+{
+    os_fstat_t st;
+    size_t     chunk = csp_buffer_data_size() - BUS_COMMS_XFER_DATA_HDR_LEN;
+
+    memset(&g_xfer_tx, 0, sizeof(g_xfer_tx));
+    g_xfer_tx.dest = dest;
+    g_xfer_tx.id   = g_xfer_next_id++;
+    strncpy(g_xfer_tx.dst, dst, sizeof(g_xfer_tx.dst) - 1);
+    OS_GetLocalTime(&g_xfer_tx.start_time);
+    g_xfer_tx.last_status = g_xfer_tx.start_time;
+
+    if (OS_stat(src, &st) != OS_SUCCESS || OS_OpenCreate(&g_xfer_tx.fd, src, OS_FILE_FLAG_NONE, OS_READ_ONLY) != OS_SUCCESS)
+    {
+        BUS_COMMS_STAT_INC(XferErrors);
+        CFE_EVS_SendEvent(BUS_COMMS_XFER_ERR_EID, CFE_EVS_EventType_ERROR, "BUS_COMMS: cannot open %s", src);
+        return;
+    }
+
+    g_xfer_tx.active  = true;
+    g_xfer_tx.size    = (uint32)OS_FILESTAT_SIZE(st);
+    g_xfer_tx.chunk   = (uint16)((chunk > 0xFFFF) ? 0xFFFF : chunk);
+    g_xfer_tx.nchunks = (g_xfer_tx.size + g_xfer_tx.chunk - 1) / g_xfer_tx.chunk;
+
+    if (g_xfer_tx.nchunks > BUS_COMMS_XFER_MAX_CHUNKS)
+    {
+        BUS_COMMS_XferTxEnd(false, "file too large");
+    }
+    else if (!BUS_COMMS_XferFileCrc(g_xfer_tx.fd, g_xfer_tx.size, g_xfer_tx_io, &g_xfer_tx.crc))
+    {
+        BUS_COMMS_XferTxEnd(false, "read error");
+    }
+    else
+    {
+        CFE_EVS_SendEvent(BUS_COMMS_XFER_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "BUS_COMMS: sending %s (%lu bytes) to %u:%s", src, (unsigned long)g_xfer_tx.size,
+                          (unsigned)dest, dst);
+        BUS_COMMS_XferTxSendStart();
+    }
+}
+
+/* Returns 0 when queued, 1 when the TX queue or buffer pool is full, -1 on a read error */
+static int32 BUS_COMMS_XferTxSendData(uint32 index)
+{
+    uint32        off = index * g_xfer_tx.chunk;
+    uint32        len = (g_xfer_tx.size - off < g_xfer_tx.chunk) ? (g_xfer_tx.size - off) : g_xfer_tx.chunk;
+    int32         n;
+    csp_packet_t *packet;
+
+    /* Refill the read cache with the next large block when the chunk is outside it */
+    if (off < g_xfer_tx.cache_off || off + len > g_xfer_tx.cache_off + g_xfer_tx.cache_len)
+    {
+        g_xfer_tx.cache_len = 0;
+
+        if (OS_lseek(g_xfer_tx.fd, (int32)off, OS_SEEK_SET) != (int32)off)
+        {
+            return -1;
+        }
+
+        n = OS_read(g_xfer_tx.fd, g_xfer_tx_io, sizeof(g_xfer_tx_io));
+        if (n < (int32)len)
+        {
+            return -1;
+        }
+
+        g_xfer_tx.cache_off = off;
+        g_xfer_tx.cache_len = (uint32)n;
+    }
+
+    packet = BUS_COMMS_BufGet(BUS_COMMS_XFER_DATA_HDR_LEN + len, 0);
+    if (packet == NULL)
+    {
+        return 1;
+    }
+
+    packet->data[0] = BUS_COMMS_XFER_PKT_DATA;
+    BUS_COMMS_Put16(&packet->data[1], g_xfer_tx.id);
+    BUS_COMMS_Put32(&packet->data[3], index);
+    memcpy(&packet->data[BUS_COMMS_XFER_DATA_HDR_LEN], &g_xfer_tx_io[off - g_xfer_tx.cache_off], len);
+    packet->length = (uint16_t)(BUS_COMMS_XFER_DATA_HDR_LEN + len);
+
+    if (BUS_COMMS_TxqPushWait(BUS_COMMS_XFER_PRIO, g_xfer_tx.dest, g_xfer_port, BUS_COMMS_PORT_MODE_DGRAM, packet,
+                              BUS_COMMS_XFER_QUEUE_WAIT_MSEC) != 0)
+    {
+        return 1;
+    }
+
+    BUS_COMMS_STAT_ADD(XferTxBytes, len);
+    return 0;
+}
+
+/* Resend the holes reported by the receiver, then fill the window with new chunks */
+static void BUS_COMMS_XferTxPump(void)
+{
+    uint32 i;
+    int32  rc;
+
+    if (!g_xfer_tx.active || !g_xfer_tx.started)
+    {
+        return;
+    }
+
+    for (i = 0; i < 64 && g_xfer_tx.retx != 0; ++i)
+    {
+        if ((g_xfer_tx.retx & ((uint64)1 << i)) == 0)
+        {
+            continue;
+        }
+
+        rc = BUS_COMMS_XferTxSendData(g_xfer_tx.base + i);
+        if (rc != 0)
+        {
+            if (rc < 0)
+            {
+                BUS_COMMS_XferTxEnd(false, "read error");
+            }
+            return;
+        }
+
+        g_xfer_tx.retx &= ~((uint64)1 << i);
+        BUS_COMMS_STAT_INC(XferRetransmits);
+    }
+
+    while (g_xfer_tx.next < g_xfer_tx.nchunks && g_xfer_tx.next < g_xfer_tx.base + BUS_COMMS_XFER_WINDOW)
+    {
+        rc = BUS_COMMS_XferTxSendData(g_xfer_tx.next);
+        if (rc != 0)
+        {
+            if (rc < 0)
+            {
+                BUS_COMMS_XferTxEnd(false, "read error");
+            }
+            return;
+        }
+
+        g_xfer_tx.next++;
+    }
+}
+
+static void BUS_COMMS_XferTxOnStatus(uint8_t src, const uint8 *pkt, uint16 len)
+{
+    uint8  code;
+    uint32 base;
+    uint32 high;
+    uint64 mask;
+
+    if (!g_xfer_tx.active || src != g_xfer_tx.dest || len < BUS_COMMS_XFER_STATUS_LEN ||
+        BUS_COMMS_Get16(&pkt[1]) != g_xfer_tx.id)
+    {
+        return;
+    }
+
+    code = pkt[3];
+    base = BUS_COMMS_Get32(&pkt[4]);
+    high = BUS_COMMS_Get32(&pkt[8]);
+    mask = BUS_COMMS_Get64(&pkt[12]);
+
+    switch (code)
+    {
+        case BUS_COMMS_XFER_ST_COMPLETE:
+            BUS_COMMS_XferTxEnd(true, NULL);
+            return;
+        case BUS_COMMS_XFER_ST_PROGRESS:
+            break;
+        case BUS_COMMS_XFER_ST_BUSY:
+            BUS_COMMS_XferTxEnd(false, "receiver busy");
+            return;
+        case BUS_COMMS_XFER_ST_CRC_ERROR:
+            BUS_COMMS_XferTxEnd(false, "CRC mismatch at receiver");
+            return;
+        default:
+            BUS_COMMS_XferTxEnd(false, "receiver error");
+            return;
+    }
+
+    g_xfer_tx.started = true;
+    g_xfer_tx.probes  = 0;
+    OS_GetLocalTime(&g_xfer_tx.last_status);
+
+    if (base > g_xfer_tx.nchunks || high > g_xfer_tx.nchunks)
+    {
+        return;
+    }
+
+    if (base > g_xfer_tx.base)
+    {
+        g_xfer_tx.retx = (base - g_xfer_tx.base >= 64) ? 0 : (g_xfer_tx.retx >> (base - g_xfer_tx.base));
+        g_xfer_tx.base = base;
+    }
+
+    /* A resumed receive may already hold chunks the sender has not sent yet */
+    if (g_xfer_tx.next < g_xfer_tx.base)
+    {
+        g_xfer_tx.next = g_xfer_tx.base;
+    }
+
+    /* Selective NACK: anything missing below the receiver's high-water mark */
+    for (uint32 i = 0; i < 64 && base + i < high && base + i < g_xfer_tx.next; ++i)
+    {
+        if ((mask & ((uint64)1 << i)) == 0 && base + i >= g_xfer_tx.base)
+        {
+            g_xfer_tx.retx |= (uint64)1 << (base + i - g_xfer_tx.base);
+        }
+    }
+}
+
+/* No status for a while: re-announce, or resend the oldest chunk to draw one */
+static void BUS_COMMS_XferTxCheckTimeout(OS_time_t now)
+{
+    if (!g_xfer_tx.active ||
+        OS_TimeGetTotalMilliseconds(OS_TimeSubtract(now, g_xfer_tx.last_status)) < BUS_COMMS_XFER_ACK_TIMEOUT)
+    {
+        return;
+    }
+
+    if (++g_xfer_tx.probes > BUS_COMMS_XFER_MAX_RETRIES)
+    {
+        BUS_COMMS_XferTxEnd(false, "no response");
+        return;
+    }
+
+    g_xfer_tx.last_status = now;
+
+    if (!g_xfer_tx.started)
+    {
+        BUS_COMMS_XferTxSendStart();
+    }
+    else if (g_xfer_tx.base < g_xfer_tx.nchunks)
+    {
+        g_xfer_tx.retx |= 1;
+    }
+}
+
+/* ------------------ Receiver ------------------ */
+
+static void BUS_COMMS_XferRxClose(bool remove_tmp)
+{
+    OS_close(g_xfer_rx.fd);
+    if (remove_tmp)
+    {
+        OS_remove(g_xfer_rx.tmp);
+    }
+    g_xfer_rx.active = false;
+}
+
+static void BUS_COMMS_XferRxFail(uint8 code, const char *reason)
+{
+    BUS_COMMS_XferSendStatus(g_xfer_rx.src, g_xfer_rx.id, code);
+    BUS_COMMS_XferRxClose(true);
+
+    BUS_COMMS_STAT_INC(XferErrors);
+    CFE_EVS_SendEvent(BUS_COMMS_XFER_ERR_EID, CFE_EVS_EventType_ERROR, "BUS_COMMS: receive of %s failed: %s",
+                      g_xfer_rx.dst, reason);
+}
+
+/* All chunks written: check the CRC, then move the file into place in one step */
+static void BUS_COMMS_XferRxComplete(void)
+{
+    uint32 crc;
+
+    if (!BUS_COMMS_XferFileCrc(g_xfer_rx.fd, g_xfer_rx.size, g_xfer_rx_io, &crc))
+    {
+        BUS_COMMS_XferRxFail(BUS_COMMS_XFER_ST_IO_ERROR, "read back failed");
+        return;
+    }
+
+    if (crc != g_xfer_rx.crc)
+    {
+        BUS_COMMS_XferRxFail(BUS_COMMS_XFER_ST_CRC_ERROR, "CRC mismatch");
+        return;
+    }
+
+    OS_close(g_xfer_rx.fd);
+    if (OS_rename(g_xfer_rx.tmp, g_xfer_rx.dst) != OS_SUCCESS)
+    {
+        OS_remove(g_xfer_rx.tmp);
+        g_xfer_rx.active = false;
+        BUS_COMMS_XferSendStatus(g_xfer_rx.src, g_xfer_rx.id, BUS_COMMS_XFER_ST_IO_ERROR);
+        BUS_COMMS_STAT_INC(XferErrors);
+        CFE_EVS_SendEvent(BUS_COMMS_XFER_ERR_EID, CFE_EVS_EventType_ERROR, "BUS_COMMS: rename to %s failed",
+                          g_xfer_rx.dst);
+        return;
+    }
+
+    BUS_COMMS_XferSendStatus(g_xfer_rx.src, g_xfer_rx.id, BUS_COMMS_XFER_ST_COMPLETE);
+    g_xfer_rx.active = false;
+
+    g_xfer_rx_done.valid = true;
+    g_xfer_rx_done.src   = g_xfer_rx.src;
+    g_xfer_rx_done.id    = g_xfer_rx.id;
+
+    BUS_COMMS_STAT_INC(XferRxFiles);
+    CFE_EVS_SendEvent(BUS_COMMS_XFER_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "BUS_COMMS: received %s (%lu bytes) from %u", g_xfer_rx.dst, (unsigned long)g_xfer_rx.size,
+                      (unsigned)g_xfer_rx.src);
+}
+
+static void BUS_COMMS_XferRxOnStart(uint8_t src, const uint8 *pkt, uint16 len, OS_time_t now)
+{
+    uint16 id;
+    uint32 size;
+    uint16 chunk;
+    uint32 crc;
+    uint32 nchunks;
+    char   dst[CFE_MISSION_MAX_PATH_LEN];
+
+    if (len < BUS_COMMS_XFER_START_LEN)
+    {
+        return;
+    }
+
+    id    = BUS_COMMS_Get16(&pkt[1]);
+    size  = BUS_COMMS_Get32(&pkt[3]);
+    chunk = BUS_COMMS_Get16(&pkt[7]);
+    crc   = BUS_COMMS_Get32(&pkt[9]);
+    memcpy(dst, &pkt[13], sizeof(dst));
+
+    if (g_xfer_rx.active && g_xfer_rx.src == src)
+    {
+        if (g_xfer_rx.id == id)
+        {
+            /* START repeated because our status was lost */
+            BUS_COMMS_XferSendStatus(src, id, BUS_COMMS_XFER_ST_PROGRESS);
+            return;
+        }
+
+        if (g_xfer_rx.size == size && g_xfer_rx.crc == crc && g_xfer_rx.chunk == chunk &&
+            strncmp(g_xfer_rx.dst, dst, sizeof(dst)) == 0)
+        {
+            /* Same file again: resume from what is already written */
+            g_xfer_rx.id   = id;
+            g_xfer_rx.last = now;
+            BUS_COMMS_XferSendStatus(src, id, BUS_COMMS_XFER_ST_PROGRESS);
+            CFE_EVS_SendEvent(BUS_COMMS_XFER_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "BUS_COMMS: resuming receive of %s at chunk %lu", dst, (unsigned long)g_xfer_rx.base);
+            return;
+        }
+    }
+
+    if (g_xfer_rx.active)
+    {
+        if (OS_TimeGetTotalMilliseconds(OS_TimeSubtract(now, g_xfer_rx.last)) < BUS_COMMS_XFER_RX_STALE_MSEC)
+        {
+            BUS_COMMS_XferSendStatus(src, id, BUS_COMMS_XFER_ST_BUSY);
+            return;
+        }
+
+        BUS_COMMS_XferRxClose(true);
+    }
+
+    nchunks = (chunk == 0) ? 0 : (size + chunk - 1) / chunk;
+
+    if (chunk == 0 || chunk > csp_buffer_data_size() - BUS_COMMS_XFER_DATA_HDR_LEN ||
+        nchunks > BUS_COMMS_XFER_MAX_CHUNKS || memchr(dst, 0, sizeof(dst)) == NULL || dst[0] == 0 ||
+        strlen(dst) + 4 >= sizeof(g_xfer_rx.tmp))
+    {
+        BUS_COMMS_XferSendStatus(src, id, BUS_COMMS_XFER_ST_REJECTED);
+        return;
+    }
+
+    memset(&g_xfer_rx, 0, sizeof(g_xfer_rx));
+    g_xfer_rx.src     = src;
+    g_xfer_rx.id      = id;
+    g_xfer_rx.size    = size;
+    g_xfer_rx.chunk   = chunk;
+    g_xfer_rx.crc     = crc;
+    g_xfer_rx.nchunks = nchunks;
+    g_xfer_rx.last    = now;
+    memcpy(g_xfer_rx.dst, dst, sizeof(dst));
+    snprintf(g_xfer_rx.tmp, sizeof(g_xfer_rx.tmp), "%s.tmp", dst);
+
+    if (OS_OpenCreate(&g_xfer_rx.fd, g_xfer_rx.tmp, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE) !=
+        OS_SUCCESS)
+    {
+        BUS_COMMS_XferSendStatus(src, id, BUS_COMMS_XFER_ST_IO_ERROR);
+        BUS_COMMS_STAT_INC(XferErrors);
+        CFE_EVS_SendEvent(BUS_COMMS_XFER_ERR_EID, CFE_EVS_EventType_ERROR, "BUS_COMMS: cannot create %s",
+                          g_xfer_rx.tmp);
+        return;
+    }
+
+    g_xfer_rx.active = true;
+
+    if (nchunks == 0)
+    {
+        BUS_COMMS_XferRxComplete();
+    }
+    else
+    {
+        BUS_COMMS_XferSendStatus(src, id, BUS_COMMS_XFER_ST_PROGRESS);
+    }
+}
+
+static void BUS_COMMS_XferRxOnData(uint8_t src, const uint8 *pkt, uint16 len, OS_time_t now)
+{
+    uint16 id = BUS_COMMS_Get16(&pkt[1]);
+    uint32 index;
+    uint32 expect;
+    uint32 off;
+    uint16 n;
+    bool   gap;
+
+    if (!g_xfer_rx.active || g_xfer_rx.src != src || g_xfer_rx.id != id)
+    {
+        /* A sender that missed our COMPLETE keeps probing; answer it again */
+        if (g_xfer_rx_done.valid && g_xfer_rx_done.src == src && g_xfer_rx_done.id == id)
+        {
+            BUS_COMMS_XferSendStatus(src, id, BUS_COMMS_XFER_ST_COMPLETE);
+        }
+        return;
+    }
+
+    index = BUS_COMMS_Get32(&pkt[3]);
+    n     = (uint16)(len - BUS_COMMS_XFER_DATA_HDR_LEN);
+    if (index >= g_xfer_rx.nchunks)
+    {
+        return;
+    }
+
+    off    = index * g_xfer_rx.chunk;
+    expect = (g_xfer_rx.size - off < g_xfer_rx.chunk) ? (g_xfer_rx.size - off) : g_xfer_rx.chunk;
+    if (n != expect)
+    {
+        return;
+    }
+
+    g_xfer_rx.last = now;
+
+    if (BUS_COMMS_XferHave(index))
+    {
+        /* Duplicate, usually a probe: the sender is waiting for our status */
+        BUS_COMMS_XferSendStatus(src, id, BUS_COMMS_XFER_ST_PROGRESS);
+        return;
+    }
+
+    if (OS_lseek(g_xfer_rx.fd, (int32)off, OS_SEEK_SET) != (int32)off ||
+        OS_write(g_xfer_rx.fd, &pkt[BUS_COMMS_XFER_DATA_HDR_LEN], n) != (int32)n)
+    {
+        BUS_COMMS_XferRxFail(BUS_COMMS_XFER_ST_IO_ERROR, "write failed");
+        return;
+    }
+
+    g_xfer_rx.have[index / 8] |= (uint8)(1u << (index % 8));
+    g_xfer_rx.received++;
+    BUS_COMMS_STAT_ADD(XferRxBytes, n);
+
+    /* Report on a new hole, and on each hole filled so the sender sees progress */
+    gap = (index != g_xfer_rx.high);
+    if (index + 1 > g_xfer_rx.high)
+    {
+        g_xfer_rx.high = index + 1;
+    }
+
+    while (g_xfer_rx.base < g_xfer_rx.nchunks && BUS_COMMS_XferHave(g_xfer_rx.base))
+    {
+        g_xfer_rx.base++;
+    }
+
+    if (g_xfer_rx.received == g_xfer_rx.nchunks)
+    {
+        BUS_COMMS_XferRxComplete();
+    }
+    else if (gap || ++g_xfer_rx.since_status >= BUS_COMMS_XFER_ACK_EVERY)
+    {
+        BUS_COMMS_XferSendStatus(src, id, BUS_COMMS_XFER_ST_PROGRESS);
+    }
+}
+
+/* ------------------ Task ------------------ */
+
+static void BUS_COMMS_XferDispatch(csp_packet_t *packet, OS_time_t now)
+{
+    uint8_t src = (uint8_t)packet->id.src;
+
+    BUS_COMMS_RouteUpdateRx(src, packet->id.dport, packet->length);
+
+    if (packet->length >= BUS_COMMS_XFER_ABORT_LEN)
+    {
+        switch (packet->data[0])
+        {
+            case BUS_COMMS_XFER_PKT_START:
+                BUS_COMMS_XferRxOnStart(src, packet->data, packet->length, now);
+                break;
+            case BUS_COMMS_XFER_PKT_DATA:
+                if (packet->length > BUS_COMMS_XFER_DATA_HDR_LEN)
+                {
+                    BUS_COMMS_XferRxOnData(src, packet->data, packet->length, now);
+                }
+                break;
+            case BUS_COMMS_XFER_PKT_STATUS:
+                BUS_COMMS_XferTxOnStatus(src, packet->data, packet->length);
+                break;
+            case BUS_COMMS_XFER_PKT_ABORT:
+                if (g_xfer_rx.active && g_xfer_rx.src == src && g_xfer_rx.id == BUS_COMMS_Get16(&packet->data[1]))
+                {
+                    BUS_COMMS_XferRxClose(true);
+                    CFE_EVS_SendEvent(BUS_COMMS_XFER_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                      "BUS_COMMS: receive of %s aborted by sender", g_xfer_rx.dst);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    csp_buffer_free(packet);
+}
+
+/* Pick up a send request or abort from the command pipe */
+static void BUS_COMMS_XferPoll(void)
+{
+    BUS_COMMS_XferRequest_t req;
+    uint8                   buf[BUS_COMMS_XFER_ABORT_LEN];
+
+    OS_MutSemTake(g_xfer_mutex);
+    req                = g_xfer_req;
+    g_xfer_req.pending = false;
+    g_xfer_req.abort   = false;
+    OS_MutSemGive(g_xfer_mutex);
+
+    if (req.abort && g_xfer_tx.active)
+    {
+        buf[0] = BUS_COMMS_XFER_PKT_ABORT;
+        BUS_COMMS_Put16(&buf[1], g_xfer_tx.id);
+        BUS_COMMS_XferSend(g_xfer_tx.dest, buf, sizeof(buf));
+        BUS_COMMS_XferTxEnd(false, "aborted");
+    }
+
+    if (req.pending)
+    {
+        BUS_COMMS_XferTxBegin(req.dest, req.src, req.dst);
+    }
+}
+
+int32 BUS_COMMS_XferInit(uint8_t port)
+{
+    memset(&g_xfer_req, 0, sizeof(g_xfer_req));
+    memset(&g_xfer_tx, 0, sizeof(g_xfer_tx));
+    memset(&g_xfer_rx, 0, sizeof(g_xfer_rx));
+    g_xfer_port = port;
+
+    return OS_MutSemCreate(&g_xfer_mutex, "BC_XFER_MUT", 0);
+}
+
+int32 BUS_COMMS_XferRequest(uint8_t dest, const char *SrcFilename, const char *DstFilename)
+{
+    int32 status = CFE_SUCCESS;
+
+    OS_MutSemTake(g_xfer_mutex);
+
+    /* g_xfer_tx.active is only read here, a stale value at worst rejects or queues one request late */
+    if (g_xfer_req.pending || g_xfer_tx.active)
+    {
+        status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+    else
+    {
+        g_xfer_req.pending = true;
+        g_xfer_req.dest    = dest;
+        strncpy(g_xfer_req.src, SrcFilename, sizeof(g_xfer_req.src) - 1);
+        g_xfer_req.src[sizeof(g_xfer_req.src) - 1] = 0;
+        strncpy(g_xfer_req.dst, DstFilename, sizeof(g_xfer_req.dst) - 1);
+        g_xfer_req.dst[sizeof(g_xfer_req.dst) - 1] = 0;
+    }
+
+    OS_MutSemGive(g_xfer_mutex);
+
+    return status;
+}
+
+void BUS_COMMS_XferAbort(void)
+{
+    OS_MutSemTake(g_xfer_mutex);
+    g_xfer_req.abort = true;
+    OS_MutSemGive(g_xfer_mutex);
+}
+
+void BUS_COMMS_XferTask(void)
+{
+    csp_socket_t  sock = {.opts = CSP_SO_CONN_LESS};
+    csp_packet_t *packet;
+    OS_time_t     now;
+    uint32        count;
+
+    if (g_xfer_port == 0 || csp_bind(&sock, g_xfer_port) != CSP_ERR_NONE)
+    {
+        CFE_ES_WriteToSysLog("BUS_COMMS: file transfer disabled (port %u)\n", (unsigned)g_xfer_port);
+        BUS_COMMS_ChildExit();
+        return;
+    }
+
+    while (BUS_COMMS_Running())
+    {
+        BUS_COMMS_XferPoll();
+
+        packet = csp_recvfrom(&sock, g_xfer_tx.active ? BUS_COMMS_XFER_TX_POLL_MSEC : BUS_COMMS_XFER_IDLE_MSEC);
+        OS_GetLocalTime(&now);
+
+        for (count = 0; packet != NULL; ++count)
+        {
+            BUS_COMMS_XferDispatch(packet, now);
+            packet = (count + 1 < BUS_COMMS_XFER_RX_BURST) ? csp_recvfrom(&sock, 0) : NULL;
+        }
+
+        BUS_COMMS_XferTxCheckTimeout(now);
+        BUS_COMMS_XferTxPump();
+    }
+    BUS_COMMS_ChildExit();
+}
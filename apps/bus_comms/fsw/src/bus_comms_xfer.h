@@ -0,0 +1,46 @@
+/************************************************************************
+ * Bus Communications App - bulk file transfer
+ ************************************************************************/
+#ifndef BUS_COMMS_XFER_H
+#define BUS_COMMS_XFER_H
+
+#include "cfe.h"
+
+#include <stdint.h>
+
+/*
+ * Point-to-point file transfer over connection-less CSP on the table's
+ * XferPort.  The sender announces the file (size, chunk size, CRC and
+ * destination name), then streams fixed-size chunks with up to
+ * BUS_COMMS_XFER_WINDOW of them unacknowledged.  The receiver writes each
+ * chunk at its offset in "<dest>.tmp" and periodically returns a status
+ * carrying its first missing chunk plus a bitmap of the chunks after it;
+ * the sender retransmits only the holes.  Once every chunk is in, the
+ * receiver checks the CRC and renames the temporary file into place, so
+ * the destination never holds a partial file.
+ *
+ * An interrupted receive is kept, and a new transfer of the same file
+ * (same source node, destination name, size and CRC) resumes from the
+ * chunks already written.  One send and one receive can run at a time.
+ */
+#define BUS_COMMS_XFER_WINDOW          32   /* chunks in flight, at most 64 */
+#define BUS_COMMS_XFER_ACK_EVERY       16   /* receiver status every N chunks */
+#define BUS_COMMS_XFER_ACK_TIMEOUT     1000 /* msec without status before the sender probes */
+#define BUS_COMMS_XFER_MAX_RETRIES     10   /* consecutive probes before giving up */
+#define BUS_COMMS_XFER_RX_STALE_MSEC   60000 /* idle receive that a different file may replace */
+#define BUS_COMMS_XFER_MAX_CHUNKS      16384
+#define BUS_COMMS_XFER_READ_SIZE       8192 /* file I/O block */
+#define BUS_COMMS_XFER_QUEUE_WAIT_MSEC 500
+
+int32 BUS_COMMS_XferInit(uint8_t port);
+
+/* Queue a send of 'SrcFilename' to 'DstFilename' on node 'dest' */
+int32 BUS_COMMS_XferRequest(uint8_t dest, const char *SrcFilename, const char *DstFilename);
+
+/* Abort the send in progress, if any */
+void BUS_COMMS_XferAbort(void);
+
+/* Child task body: owns the XferPort socket and both transfer sessions */
+void BUS_COMMS_XferTask(void);
+
+#endif /* BUS_COMMS_XFER_H */
@@ -0,0 +1,43 @@
+/************************************************************************
+ * Bus Communications App - loopback simulation table
+ ************************************************************************/
+
+#include "cfe_tbl_filedef.h" /* Required to obtain the CFE_TBL_FILEDEF macro definition */
+#include "bus_comms_table.h"
+
+/*
+ * Single node with no CAN hardware: every CSP packet goes through the
+ * loopback interface back to node 1.  Rate limits are removed and no
+ * periodic sends are configured so benchmark runs measure the app alone.
+ * Install as /cf/bus_comms_tbl.tbl (see tools/bus_comms_bench.py).
+ */
+BUS_COMMS_Table_t BusCommsLoTable = {
+    .CspPort         = 10,
+    .XferPort        = 11,
+    .BenchPort       = 12,
+    .HbPort          = 13,
+    .HbPeriodMsec    = 1000,
+    .HbMissLimit     = 3,
+    .CmdBudgetMsec   = 2000,
+    .CspBufferCount  = 0, /* whole pool */
+    .BridgePipeDepth = 32,
+    .TxQueueDepth    = 32,
+
+    .Interfaces =
+        {
+            {.Type = BUS_COMMS_IF_TYPE_LOOPBACK, .InUse = true},
+        },
+
+    .DefaultNode = {.ProcessorId = 0, .MyAddr = 1, .PeerAddr = 1, .InUse = true},
+
+    .DefaultBytesPerSec = 0, /* unlimited */
+};
+
+/*
+** The macro below identifies:
+**    1) the data structure type to use as the table image format
+**    2) the name of the table to be placed into the cFE Table File Header
+**    3) a brief description of the contents of the file image
+**    4) the desired name of the table image binary file that is cFE compatible
+*/
+CFE_TBL_FILEDEF(BusCommsLoTable, BUS_COMMS.BusCommsTable, Bus Comms Loopback Sim Table, bus_comms_lo.tbl)
@@ -0,0 +1,48 @@
+/************************************************************************
+ * Bus Communications App - default configuration table
+ ************************************************************************/
+
+#include "cfe_tbl_filedef.h" /* Required to obtain the CFE_TBL_FILEDEF macro definition */
+#include "bus_comms_table.h"
+
+/*
+ * Two-node CAN setup: processor 1 is CSP node 1, processor 2 is node 2, and
+ * each heartbeats the other every second.  No periodic sends, SB-to-CSP
+ * bridge or ingest entries are enabled by default.
+ */
+BUS_COMMS_Table_t BusCommsTable = {
+    .CspPort         = 10,
+    .XferPort        = 11,
+    .BenchPort       = 12,
+    .HbPort          = 13,
+    .HbPeriodMsec    = 1000,
+    .HbMissLimit     = 3,
+    .CmdBudgetMsec   = 2000,
+    .CspBufferCount  = 0, /* whole pool */
+    .BridgePipeDepth = 32,
+    .TxQueueDepth    = 32,
+
+    .Interfaces =
+        {
+            {.Type = BUS_COMMS_IF_TYPE_CAN, .IsDefault = true, .InUse = true, .Device = "can0", .Bitrate = 1000000},
+        },
+
+    .DefaultNode = {.ProcessorId = 0, .MyAddr = 1, .PeerAddr = 2, .InUse = true},
+    .NodeMap =
+        {
+            {.ProcessorId = 1, .MyAddr = 1, .PeerAddr = 2, .InUse = true},
+            {.ProcessorId = 2, .MyAddr = 2, .PeerAddr = 1, .InUse = true},
+        },
+
+    .DefaultBytesPerSec = 32000,
+    .DefaultBurst       = 2048,
+};
+
+/*
+** The macro below identifies:
+**    1) the data structure type to use as the table image format
+**    2) the name of the table to be placed into the cFE Table File Header
+**    3) a brief description of the contents of the file image
+**    4) the desired name of the table image binary file that is cFE compatible
+*/
+CFE_TBL_FILEDEF(BusCommsTable, BUS_COMMS.BusCommsTable, Bus Comms Configuration Table, bus_comms_tbl.tbl)
@@ -0,0 +1,60 @@
+/************************************************************************
+ * Bus Communications App - virtual CAN simulation table
+ ************************************************************************/
+
+#include "cfe_tbl_filedef.h" /* Required to obtain the CFE_TBL_FILEDEF macro definition */
+#include "bus_comms_table.h"
+
+/*
+ * Up to four instances on the Linux vcan0 and vcan1 devices, started with
+ * --cpuid 1..4 and becoming CSP nodes 1..4; node 1 pairs with node 2 and
+ * the rest with node 1.  Nodes 1 and 2 are reached over vcan0 and nodes 3
+ * and 4 over vcan1, each failing over to the other bus.  Rate limits are
+ * removed so benchmark runs measure the stack alone.  Install as
+ * /cf/bus_comms_tbl.tbl (see tools/bus_comms_bench.py).
+ */
+BUS_COMMS_Table_t BusCommsVcanTable = {
+    .CspPort         = 10,
+    .XferPort        = 11,
+    .BenchPort       = 12,
+    .HbPort          = 13,
+    .HbPeriodMsec    = 1000,
+    .HbMissLimit     = 3,
+    .CmdBudgetMsec   = 2000,
+    .CspBufferCount  = 0, /* whole pool */
+    .BridgePipeDepth = 32,
+    .TxQueueDepth    = 32,
+
+    .Interfaces =
+        {
+            {.Type = BUS_COMMS_IF_TYPE_CAN, .IsDefault = true, .InUse = true, .Device = "vcan0", .Bitrate = 1000000},
+            {.Type = BUS_COMMS_IF_TYPE_CAN, .InUse = true, .Device = "vcan1", .Bitrate = 1000000},
+        },
+    .InterfaceRoutes =
+        {
+            {.dest = 1, .Primary = 0, .Backup = 1, .InUse = true},
+            {.dest = 2, .Primary = 0, .Backup = 1, .InUse = true},
+            {.dest = 3, .Primary = 1, .Backup = 0, .InUse = true},
+            {.dest = 4, .Primary = 1, .Backup = 0, .InUse = true},
+        },
+
+    .DefaultNode = {.ProcessorId = 0, .MyAddr = 1, .PeerAddr = 2, .InUse = true},
+    .NodeMap =
+        {
+            {.ProcessorId = 1, .MyAddr = 1, .PeerAddr = 2, .InUse = true},
+            {.ProcessorId = 2, .MyAddr = 2, .PeerAddr = 1, .InUse = true},
+            {.ProcessorId = 3, .MyAddr = 3, .PeerAddr = 1, .InUse = true},
+            {.ProcessorId = 4, .MyAddr = 4, .PeerAddr = 1, .InUse = true},
+        },
+
+    .DefaultBytesPerSec = 0, /* unlimited */
+};
+
+/*
+** The macro below identifies:
+**    1) the data structure type to use as the table image format
+**    2) the name of the table to be placed into the cFE Table File Header
+**    3) a brief description of the contents of the file image
+**    4) the desired name of the table image binary file that is cFE compatible
+*/
+CFE_TBL_FILEDEF(BusCommsVcanTable, BUS_COMMS.BusCommsTable, Bus Comms vcan Sim Table, bus_comms_vcan.tbl)
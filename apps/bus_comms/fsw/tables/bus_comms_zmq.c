@@ -0,0 +1,51 @@
+/************************************************************************
+ * Bus Communications App - ZMQ hub simulation table
+ ************************************************************************/
+
+#include "cfe_tbl_filedef.h" /* Required to obtain the CFE_TBL_FILEDEF macro definition */
+#include "bus_comms_table.h"
+
+/*
+ * Up to four instances on one host, started with --cpuid 1..4 and becoming
+ * CSP nodes 1..4, all connected to a libcsp zmqproxy on localhost in place
+ * of the CAN bus; node 1 pairs with node 2 and the rest with node 1.  Rate
+ * limits are removed so benchmark runs measure the stack alone.  Install
+ * as /cf/bus_comms_tbl.tbl (see tools/bus_comms_bench.py).
+ */
+BUS_COMMS_Table_t BusCommsZmqTable = {
+    .CspPort         = 10,
+    .XferPort        = 11,
+    .BenchPort       = 12,
+    .HbPort          = 13,
+    .HbPeriodMsec    = 1000,
+    .HbMissLimit     = 3,
+    .CmdBudgetMsec   = 2000,
+    .CspBufferCount  = 0, /* whole pool */
+    .BridgePipeDepth = 32,
+    .TxQueueDepth    = 32,
+
+    .Interfaces =
+        {
+            {.Type = BUS_COMMS_IF_TYPE_ZMQ, .IsDefault = true, .InUse = true, .Device = "localhost"},
+        },
+
+    .DefaultNode = {.ProcessorId = 0, .MyAddr = 1, .PeerAddr = 2, .InUse = true},
+    .NodeMap =
+        {
+            {.ProcessorId = 1, .MyAddr = 1, .PeerAddr = 2, .InUse = true},
+            {.ProcessorId = 2, .MyAddr = 2, .PeerAddr = 1, .InUse = true},
+            {.ProcessorId = 3, .MyAddr = 3, .PeerAddr = 1, .InUse = true},
+            {.ProcessorId = 4, .MyAddr = 4, .PeerAddr = 1, .InUse = true},
+        },
+
+    .DefaultBytesPerSec = 0, /* unlimited */
+};
+
+/*
+** The macro below identifies:
+**    1) the data structure type to use as the table image format
+**    2) the name of the table to be placed into the cFE Table File Header
+**    3) a brief description of the contents of the file image
+**    4) the desired name of the table image binary file that is cFE compatible
+*/
+CFE_TBL_FILEDEF(BusCommsZmqTable, BUS_COMMS.BusCommsTable, Bus Comms ZMQ Sim Table, bus_comms_zmq.tbl)
@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+"""
+Bus Communications App - benchmark driver
+
+Starts one or more cFS instances from an installed exe directory, each in a
+scratch copy with one of the simulation tables installed as
+/cf/bus_comms_tbl.tbl, then sweeps payload size, rate and destination count
+by sending BUS_COMMS BENCH commands to instance 1 through CI_LAB.  Results
+are taken from the BENCH summary event on instance 1's console.
+
+  loopback  one instance, every packet goes through the CSP loopback
+            interface; needs nothing but a Linux box, so CI runs this
+  vcan      --nodes instances on the vcan0 and vcan1 SocketCAN devices;
+            create them with --setup-vcan (root) or beforehand:
+                ip link add dev vcan0 type vcan && ip link set up vcan0
+                (and the same for vcan1)
+  zmq       --nodes instances on a libcsp zmqproxy on localhost; start it
+            beforehand or pass its path with --zmqproxy
+
+Example:
+  bus_comms_bench.py --exe-dir build/exe/cpu1 --sizes 16,64,200 \\
+      --rates 0,500 --count 1000 --max-drop-pct 0
+
+Latencies are round trips through the remote node's echo.  The exit status
+is 1 when any run drops more than --max-drop-pct of its packets or fails.
+"""
+
+import argparse
+import os
+import queue
+import re
+import shutil
+import socket
+import struct
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+BUS_COMMS_CMD_MID = 0x1888
+BUS_COMMS_BENCH_CC = 0x16
+BUS_COMMS_BENCH_MAX_DESTS = 8
+BUS_COMMS_BENCH_DRAIN_SEC = 1.0
+CI_LAB_BASE_UDP_PORT = 1234
+
+TABLES = {"loopback": "bus_comms_lo.tbl", "vcan": "bus_comms_vcan.tbl", "zmq": "bus_comms_zmq.tbl"}
+VCAN_DEVICES = ["vcan0", "vcan1"]
+
+BENCH_RE = re.compile(r"BENCH (run=\d+.*)$")
+READY_RE = re.compile(r"BUS_COMMS App Initialized")
+
+
+def bench_cmd(count, length, rate, dests):
+    """BUS_COMMS_BenchCmd_t with a CCSDS v1 command header (host byte order payload)."""
+    padded = bytes(dests).ljust(BUS_COMMS_BENCH_MAX_DESTS, b"\0")
+    payload = struct.pack("<HHIB8s3x", count, length, rate, len(dests), padded)
+    total = 8 + len(payload)
+    pkt = bytearray(struct.pack(">HHHBB", BUS_COMMS_CMD_MID, 0xC000, total - 7, BUS_COMMS_BENCH_CC, 0) + payload)
+    checksum = 0xFF
+    for b in pkt:
+        checksum ^= b
+    pkt[7] = checksum
+    return bytes(pkt)
+
+
+class Instance:
+    def __init__(self, exe_dir, cpuid, table):
+        self.cpuid = cpuid
+        self.dir = tempfile.mkdtemp(prefix="bus_comms_bench_cpu%d_" % cpuid)
+        shutil.copytree(exe_dir, self.dir, dirs_exist_ok=True)
+        shutil.copyfile(os.path.join(self.dir, "cf", table), os.path.join(self.dir, "cf", "bus_comms_tbl.tbl"))
+        exe = [f for f in os.listdir(self.dir) if f.startswith("core-")][0]
+        self.lines = queue.Queue()
+        self.proc = subprocess.Popen(
+            ["./" + exe, "--reset", "PO", "--cpuid", str(cpuid), "--cpuname", "CPU%d" % cpuid],
+            cwd=self.dir, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True, errors="replace")
+        threading.Thread(target=self._reader, daemon=True).start()
+
+    def _reader(self):
+        for line in self.proc.stdout:
+            self.lines.put(line.rstrip())
+
+    def wait_for(self, pattern, timeout):
+        deadline = time.monotonic() + timeout
+        while time.monotonic() < deadline:
+            try:
+                line = self.lines.get(timeout=max(0.0, deadline - time.monotonic()))
+            except queue.Empty:
+                break
+            m = pattern.search(line)
+            if m:
+                return m
+        return None
+
+    def stop(self):
+        self.proc.terminate()
+        try:
+            self.proc.wait(timeout=5)
+        except subprocess.TimeoutExpired:
+            self.proc.kill()
+        shutil.rmtree(self.dir, ignore_errors=True)
+
+
+def int_list(text):
+    return [int(v) for v in text.split(",") if v]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--exe-dir", required=True, help="installed cFS exe directory (contains core-* and cf/)")
+    parser.add_argument("--mode", choices=sorted(TABLES), default="loopback")
+    parser.add_argument("--nodes", type=int, default=2, help="vcan/zmq instances to start, 2..4")
+    parser.add_argument("--setup-vcan", action="store_true", help="create and raise vcan0/vcan1 first (needs root)")
+    parser.add_argument("--zmqproxy", help="start this zmqproxy binary for zmq mode")
+    parser.add_argument("--sizes", type=int_list, default=[16, 64, 200], help="payload bytes, comma separated")
+    parser.add_argument("--rates", type=int_list, default=[0, 1000], help="packets/s, 0 = unpaced")
+    parser.add_argument("--dests", type=int_list, default=[1], help="destination counts")
+    parser.add_argument("--count", type=int, default=1000, help="packets per run, at most 4096")
+    parser.add_argument("--startup-timeout", type=float, default=30.0)
+    parser.add_argument("--max-drop-pct", type=float, default=None, help="fail when a run drops more than this")
+    parser.add_argument("--csv", help="also write the results to this file")
+    args = parser.parse_args()
+
+    if args.setup_vcan:
+        for dev in VCAN_DEVICES:
+            subprocess.call(["ip", "link", "add", "dev", dev, "type", "vcan"])
+            subprocess.check_call(["ip", "link", "set", "up", dev])
+
+    nodes = 1 if args.mode == "loopback" else max(2, min(args.nodes, 4))
+    instances = []
+    proxy = None
+    failed = False
+    results = []
+
+    try:
+        if args.mode == "zmq" and args.zmqproxy:
+            proxy = subprocess.Popen([args.zmqproxy], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+            time.sleep(0.5)
+        for cpuid in range(1, nodes + 1):
+            instances.append(Instance(args.exe_dir, cpuid, TABLES[args.mode]))
+        for inst in instances:
+            if inst.wait_for(READY_RE, args.startup_timeout) is None:
+                sys.exit("cpu%d did not start" % inst.cpuid)
+        time.sleep(1.0)
+
+        sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        # Node 1 drives; in loopback mode it is its own destination
+        peers = [1] if nodes == 1 else list(range(2, nodes + 1))
+
+        for size in args.sizes:
+            for rate in args.rates:
+                for ndests in args.dests:
+                    ndests = max(1, min(ndests, BUS_COMMS_BENCH_MAX_DESTS))
+                    dests = [peers[i % len(peers)] for i in range(ndests)]
+                    sock.sendto(bench_cmd(args.count, size, rate, dests), ("127.0.0.1", CI_LAB_BASE_UDP_PORT))
+
+                    timeout = 10.0 + BUS_COMMS_BENCH_DRAIN_SEC + (args.count / rate if rate else 0)
+                    m = instances[0].wait_for(BENCH_RE, timeout)
+                    if m is None:
+                        print("size=%d rate=%d dests=%d: no result" % (size, rate, ndests))
+                        failed = True
+                        continue
+
+                    r = {k: int(v) for k, v in (kv.split("=") for kv in m.group(1).split())}
+                    results.append(r)
+                    drop_pct = 100.0 * r["drop"] / r["sent"] if r["sent"] else 100.0
+                    print("len=%(len)4d rate=%(rate)6d dests=%(dests)d sent=%(sent)5d fail=%(fail)4d recv=%(recv)5d "
+                          "drop=%(drop)4d pps=%(pps)6d p50=%(p50)6dus p99=%(p99)6dus max=%(max)6dus" % r)
+                    if args.max_drop_pct is not None and (drop_pct > args.max_drop_pct or r["fail"]):
+                        failed = True
+    finally:
+        for inst in instances:
+            inst.stop()
+        if proxy is not None:
+            proxy.terminate()
+            proxy.wait()
+
+    if args.csv and results:
+        with open(args.csv, "w") as f:
+            keys = list(results[0])
+            f.write(",".join(keys) + "\n")
+            for r in results:
+                f.write(",".join(str(r[k]) for k in keys) + "\n")
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -541,7 +541,9 @@ void TO_LAB_forward_telemetry(void)
     int32            status;
     int32            CFE_SB_status;
     size_t           size;
-    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_Buffer_t *SBBufPtrs[TO_LAB_TLM_BURST];
+    uint32           count;
+    uint32           i;
 
     OS_SocketAddrInit(&d_addr, OS_SocketDomain_INET);
     OS_SocketAddrSetPort(&d_addr, cfgTLM_PORT);
@@ -550,17 +552,18 @@ void TO_LAB_forward_telemetry(void)
 
     do
     {
-        CFE_SB_status = CFE_SB_ReceiveBuffer(&SBBufPtr, TO_LAB_Global.Tlm_pipe, CFE_SB_POLL);
+        CFE_SB_status =
+            CFE_SB_ReceiveBuffers(SBBufPtrs, &count, TO_LAB_TLM_BURST, TO_LAB_Global.Tlm_pipe, CFE_SB_POLL);
 
-        if ((CFE_SB_status == CFE_SUCCESS) && (TO_LAB_Global.suppress_sendto == false))
+        for (i = 0; i < count && TO_LAB_Global.suppress_sendto == false; ++i)
         {
-            CFE_MSG_GetSize(&SBBufPtr->Msg, &size);
+            CFE_MSG_GetSize(&SBBufPtrs[i]->Msg, &size);
 
             if (TO_LAB_Global.downlink_on == true)
             {
                 CFE_ES_PerfLogEntry(TO_LAB_SOCKET_SEND_PERF_ID);
 
-                status = OS_SocketSendTo(TO_LAB_Global.TLMsockid, SBBufPtr, size, &d_addr);
+                status = OS_SocketSendTo(TO_LAB_Global.TLMsockid, SBBufPtrs[i], size, &d_addr);
 
                 CFE_ES_PerfLogExit(TO_LAB_SOCKET_SEND_PERF_ID);
             }
@@ -575,7 +578,7 @@ void TO_LAB_forward_telemetry(void)
                 TO_LAB_Global.suppress_sendto = true;
             }
         }
-        /* If CFE_SB_status != CFE_SUCCESS, then no packet was received from CFE_SB_ReceiveBuffer() */
+        /* If CFE_SB_status != CFE_SUCCESS, then no packet was received from CFE_SB_ReceiveBuffers() */
     } while (CFE_SB_status == CFE_SUCCESS);
 }
 
@@ -48,6 +48,11 @@
  */
 #define TO_LAB_TLM_PIPE_DEPTH OS_QUEUE_MAX_DEPTH
 
+/**
+ * Most telemetry packets taken off the pipe per receive call
+ */
+#define TO_LAB_TLM_BURST 16
+
 #define cfgTLM_ADDR        "192.168.1.81"
 #define cfgTLM_PORT        1235
 #define TO_LAB_VERSION_NUM "5.1.0"
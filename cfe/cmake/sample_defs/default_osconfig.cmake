@@ -33,3 +33,14 @@
 # module cannot be loaded or a file cannot be opened for some reason.
 #
 set(OSAL_CONFIG_DEBUG_PRINTF TRUE)
+
+#
+# OSAL_CONFIG_MAX_COUNT_SEMAPHORES
+# --------------------------------
+#
+# With CFE_PLATFORM_SB_RING_PIPES set (the sample platform config does so
+# on POSIX), every SB pipe holds a counting semaphore instead of a queue.
+# Keep OSAL's default of 20 for applications and add one per SB pipe
+# (CFE_PLATFORM_SB_MAX_PIPES).
+#
+set(OSAL_CONFIG_MAX_COUNT_SEMAPHORES 84)
@@ -471,6 +471,79 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool UpdateHead
 ** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
 **/
 CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut);
+
+/*****************************************************************************/
+/**
+** \brief Receive a burst of messages from a software bus pipe
+**
+** \par Description
+**          This routine retrieves up to \p MaxCount messages from the specified
+**          pipe in one call.  If the pipe is empty, this routine will block until
+**          either a new message comes in or the timeout value is reached, exactly
+**          as #CFE_SB_ReceiveBuffer does; it then returns that message together
+**          with any others already waiting on the pipe, without waiting for more.
+**
+** \par Assumptions, External Events, and Notes:
+**          The pipe holds on to the returned buffers until the next call to
+**          CFE_SB_ReceiveBuffers or #CFE_SB_ReceiveBuffer for the same pipe, or
+**          until #CFE_SB_ReleaseBuffers is called for it.  A caller that keeps
+**          the buffers while it waits for the next burst should release them
+**          first, so they return to the SB pool sooner.
+**
+**          A single call never returns more than the platform's
+**          CFE_PLATFORM_SB_MAX_RECEIVE_BATCH messages, whatever \p MaxCount is.
+**
+**          An unreadable queue entry after the first message ends the burst.
+**          It is counted and reported as for #CFE_SB_ReceiveBuffer, and the
+**          messages before it are still returned with #CFE_SUCCESS.
+**
+** \param[out] BufPtrs      Array of at least \p MaxCount software bus buffer pointers
+**                          to receive to @nonnull.  On success the first *CountPtr
+**                          entries point to the messages, in the order they were sent
+**                          to the pipe.  As for #CFE_SB_ReceiveBuffer, these should be
+**                          used as read-only pointers.
+**
+** \param[out] CountPtr     Number of messages received @nonnull.  Set to 0 on failure.
+**
+** \param[in]  MaxCount     The most messages to receive, at least 1.
+**
+** \param[in]  PipeId       The pipe ID of the pipe containing the messages to be obtained.
+**
+** \param[in]  TimeOut      The number of milliseconds to wait for a new message if the
+**                          pipe is empty at the time of the call.  This can also be set
+**                          to #CFE_SB_POLL for a non-blocking receive or
+**                          #CFE_SB_PEND_FOREVER to wait forever for a message to arrive.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_TIME_OUT     \copybrief CFE_SB_TIME_OUT
+** \retval #CFE_SB_PIPE_RD_ERR  \covtest \copybrief CFE_SB_PIPE_RD_ERR
+** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
+**/
+CFE_Status_t CFE_SB_ReceiveBuffers(CFE_SB_Buffer_t **BufPtrs, uint32 *CountPtr, uint32 MaxCount,
+                                   CFE_SB_PipeId_t PipeId, int32 TimeOut);
+
+/*****************************************************************************/
+/**
+** \brief Release the messages last received from a software bus pipe
+**
+** \par Description
+**          This routine releases, in one call, every buffer the pipe handed out
+**          by the last #CFE_SB_ReceiveBuffers or #CFE_SB_ReceiveBuffer call.
+**          The buffer pointers the caller was given must not be used afterwards.
+**
+** \par Assumptions, External Events, and Notes:
+**          Releasing is optional, as the next receive on the pipe does the same.
+**          Calling it when nothing is held does nothing.
+**
+** \param[in]  PipeId       The pipe ID of the pipe the messages were received from.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**/
+CFE_Status_t CFE_SB_ReleaseBuffers(CFE_SB_PipeId_t PipeId);
 /** @} */
 
 /** @defgroup CFEAPISBZeroCopy cFE Zero Copy APIs
@@ -36,6 +36,7 @@ void UT_DefaultHandler_CFE_SB_IsValidMsgId(void *, UT_EntryKey_t, const UT_StubC
 void UT_DefaultHandler_CFE_SB_MessageStringGet(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_SB_MessageStringSet(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_SB_ReceiveBuffer(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_CFE_SB_ReceiveBuffers(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_SB_SetUserDataLength(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_SB_TimeStampMsg(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_SB_TransmitBuffer(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -267,6 +268,43 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBuffer, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_ReceiveBuffers()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_ReceiveBuffers(CFE_SB_Buffer_t **BufPtrs, uint32 *CountPtr, uint32 MaxCount,
+                                   CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_ReceiveBuffers, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, CFE_SB_Buffer_t **, BufPtrs);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, uint32 *, CountPtr);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, uint32, MaxCount);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, int32, TimeOut);
+
+    UT_GenStub_Execute(CFE_SB_ReceiveBuffers, Basic, UT_DefaultHandler_CFE_SB_ReceiveBuffers);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBuffers, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_ReleaseBuffers()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_ReleaseBuffers(CFE_SB_PipeId_t PipeId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_ReleaseBuffers, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_ReleaseBuffers, CFE_SB_PipeId_t, PipeId);
+
+    UT_GenStub_Execute(CFE_SB_ReleaseBuffers, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_ReleaseBuffers, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_ReleaseMessageBuffer()
@@ -54,6 +54,10 @@ void CFE_SBR_Init(void);
  *  element in the routing table.  Assumes check for existing
  *  route was already performed or routes could leak
  *
+ *  Routes are never removed, and the route is complete before it becomes
+ *  visible to CFE_SBR_GetRouteId(), so lookups need no lock.  Must be
+ *  called with the SB lock held.
+ *
  *  \param[in]  MsgId         Message ID of the route to add
  *  \param[out] CollisionsPtr Number of collisions (if not null)
  *
@@ -64,6 +68,9 @@ CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr);
 /**
  *  \brief Obtain the route id given a message id
  *
+ *  Safe to call without the SB lock.  A route added concurrently may not
+ *  be seen yet, exactly as if the lookup had taken the lock first.
+ *
  *  \param[in] MsgId Message ID of the route to get
  *
  *  \returns Route ID, will be invalid if can't be returned
@@ -122,6 +122,41 @@
 */
 #define CFE_PLATFORM_SB_BUF_MEMORY_BYTES 524288
 
+/**
+**  \cfesbcfg Pipe Implementation
+**
+**  \par Description:
+**       When true, each pipe is a ring of buffer descriptor pointers held in SB
+**       memory and protected by the SB lock, with an OSAL counting semaphore to
+**       wake the receiver.  Delivering a message to N pipes then costs N ring
+**       writes and N semaphore gives, which on POSIX only enter the kernel when
+**       a receiver is actually waiting.  When false, each pipe is an OSAL queue
+**       and every delivery is an OS_QueuePut() call.
+**
+**  \par Limits
+**       true or false.  Ring storage for #CFE_PLATFORM_SB_MAX_PIPES pipes of
+**       OS_QUEUE_MAX_DEPTH entries each is reserved statically when true, and
+**       each pipe then uses one of OS_MAX_COUNT_SEMAPHORES rather than one of
+**       OS_MAX_QUEUES, so OS_MAX_COUNT_SEMAPHORES must be raised by
+**       #CFE_PLATFORM_SB_MAX_PIPES above what the applications need.  Off by
+**       default; a platform enables it where its OSAL suits (the sample
+**       platform configuration does so for POSIX).
+*/
+#define CFE_PLATFORM_SB_RING_PIPES false
+
+/**
+**  \cfesbcfg Maximum Buffers per Batch Receive
+**
+**  \par Description:
+**       The most buffers a single CFE_SB_ReceiveBuffers() call returns.  The
+**       pipe keeps a reference to each until they are released, so every pipe
+**       descriptor holds this many buffer descriptor pointers.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 65535.
+*/
+#define CFE_PLATFORM_SB_MAX_RECEIVE_BATCH 16
+
 /**
 **  \cfesbcfg Highest Valid Message Id
 **
@@ -70,7 +70,8 @@
  *
  *  \par Cause:
  *
- *  #CFE_SB_CreatePipe API failure creating the queue.
+ *  #CFE_SB_CreatePipe API failure creating the queue, or the counting
+ *  semaphore of a ring pipe (see #CFE_PLATFORM_SB_RING_PIPES).
  */
 #define CFE_SB_CR_PIPE_ERR_EID 4
 
@@ -756,7 +757,8 @@
  *
  *  \par Cause:
  *
- *  #CFE_SB_CreatePipe API failure due to no free queues.
+ *  #CFE_SB_CreatePipe API failure due to no free queues, or no free
+ *  counting semaphores for a ring pipe.
  */
 #define CFE_SB_CR_PIPE_NO_FREE_EID 70
 /**\}*/
@@ -103,12 +103,16 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
     CFE_ResourceId_t PendingPipeId = CFE_RESOURCEID_UNDEFINED;
     uint16           PendingEventId;
     char             FullName[(OS_MAX_API_NAME * 2)];
+    bool             IsRing;
+    const char *     OsCreateName;
 
     Status         = CFE_SUCCESS;
     SysQueueId     = OS_OBJECT_ID_UNDEFINED;
     PendingEventId = 0;
     PipeDscPtr     = NULL;
     OsStatus       = OS_SUCCESS;
+    IsRing         = CFE_SB_Global.UseRingPipes;
+    OsCreateName   = IsRing ? "OS_CountSemCreate" : "OS_QueueCreate";
 
     /*
      * Get caller AppId.
@@ -158,8 +162,15 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
 
     if (Status == CFE_SUCCESS)
     {
-        /* create the queue */
-        OsStatus = OS_QueueCreate(&SysQueueId, PipeName, Depth, sizeof(CFE_SB_BufferD_t *), 0);
+        /* create the queue, or for a ring pipe the semaphore that wakes its receiver */
+        if (IsRing)
+        {
+            OsStatus = OS_CountSemCreate(&SysQueueId, PipeName, 0, 0);
+        }
+        else
+        {
+            OsStatus = OS_QueueCreate(&SysQueueId, PipeName, Depth, sizeof(CFE_SB_BufferD_t *), 0);
+        }
         if (OsStatus == OS_SUCCESS)
         {
             /* just translate the RC to CFE */
@@ -195,6 +206,11 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
         PipeDscPtr->MaxQueueDepth = Depth;
         PipeDscPtr->AppId         = AppId;
 
+        if (IsRing)
+        {
+            PipeDscPtr->Ring = CFE_SB_Global.PipeRing[PipeDscPtr - CFE_SB_Global.PipeTbl];
+        }
+
         CFE_SB_PipeDescSetUsed(PipeDscPtr, PendingPipeId);
 
         /* Increment the Pipes in use ctr and if it's > the high water mark,*/
@@ -252,17 +268,17 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
                 break;
             case CFE_SB_CR_PIPE_NAME_TAKEN_EID:
                 CFE_EVS_SendEventWithAppID(CFE_SB_CR_PIPE_NAME_TAKEN_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                           "CreatePipeErr:OS_QueueCreate failed, name taken (app=%s, name=%s)",
+                                           "CreatePipeErr:%s failed, name taken (app=%s, name=%s)", OsCreateName,
                                            CFE_SB_GetAppTskName(TskId, FullName), PipeName);
                 break;
             case CFE_SB_CR_PIPE_NO_FREE_EID:
                 CFE_EVS_SendEventWithAppID(CFE_SB_CR_PIPE_NO_FREE_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                           "CreatePipeErr:OS_QueueCreate failed, no free id's (app=%s)",
+                                           "CreatePipeErr:%s failed, no free id's (app=%s)", OsCreateName,
                                            CFE_SB_GetAppTskName(TskId, FullName));
                 break;
             case CFE_SB_CR_PIPE_ERR_EID:
                 CFE_EVS_SendEventWithAppID(CFE_SB_CR_PIPE_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                           "CreatePipeErr:OS_QueueCreate returned %ld,app %s", (long)OsStatus,
+                                           "CreatePipeErr:%s returned %ld,app %s", OsCreateName, (long)OsStatus,
                                            CFE_SB_GetAppTskName(TskId, FullName));
                 break;
         }
@@ -344,11 +360,13 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     size_t                      BufDscSize;
     CFE_SB_RemovePipeCallback_t Args;
     uint16                      PendingEventID;
+    bool                        IsRing;
 
     Status         = CFE_SUCCESS;
     PendingEventID = 0;
     SysQueueId     = OS_OBJECT_ID_UNDEFINED;
     BufDscPtr      = NULL;
+    IsRing         = false;
 
     /* take semaphore to prevent a task switch during this call */
     CFE_SB_LockSharedData(__func__, __LINE__);
@@ -382,7 +400,10 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
          * However we must first save certain state data for later deletion.
          */
         SysQueueId = PipeDscPtr->SysQueueId;
-        BufDscPtr  = PipeDscPtr->LastBuffer;
+        IsRing     = (PipeDscPtr->Ring != NULL);
+
+        /* The receiver is done with whatever it was last given */
+        CFE_SB_PipeReleaseHeldUnsync(PipeDscPtr);
 
         /*
          * Mark entry as "reserved" so other resources can be deleted
@@ -396,7 +417,25 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     CFE_SB_UnlockSharedData(__func__, __LINE__);
 
     /* remove any messages that might be on the pipe */
-    if (Status == CFE_SUCCESS)
+    if (Status == CFE_SUCCESS && IsRing)
+    {
+        /* Nothing can push to the ring any more, and it is only read under the lock */
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        /* release everything still on the ring */
+        BufDscPtr = CFE_SB_PipeRingPop(PipeDscPtr);
+        while (BufDscPtr != NULL)
+        {
+            CFE_SB_DecrBufUseCnt(BufDscPtr);
+            BufDscPtr = CFE_SB_PipeRingPop(PipeDscPtr);
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+        /* Delete the semaphore, which also releases the pipe name */
+        OS_CountSemDelete(SysQueueId);
+    }
+    else if (Status == CFE_SUCCESS)
     {
         while (true)
         {
@@ -756,8 +795,13 @@ CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *Pipe
     }
     else
     {
-        /* Get QueueID from OSAL */
+        /* Get QueueID from OSAL - for a ring pipe, the ID of its semaphore */
         OsStatus = OS_QueueGetIdByName(&SysQueueId, PipeName);
+        if (OsStatus != OS_SUCCESS && CFE_SB_Global.UseRingPipes)
+        {
+            OsStatus = OS_CountSemGetIdByName(&SysQueueId, PipeName);
+        }
+
         if (OsStatus == OS_SUCCESS)
         {
             Status = CFE_SUCCESS;
@@ -1289,24 +1333,49 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool UpdateHeader)
 {
-    int32             Status;
-    CFE_MSG_Size_t    Size  = 0;
-    CFE_SB_MsgId_t    MsgId = CFE_SB_INVALID_MSG_ID;
-    CFE_ES_TaskId_t   TskId;
-    char              FullName[(OS_MAX_API_NAME * 2)];
-    CFE_SB_BufferD_t *BufDscPtr;
-    CFE_SBR_RouteId_t RouteId;
-    uint16            PendingEventID;
-
-    PendingEventID = 0;
-    BufDscPtr      = NULL;
-    RouteId        = CFE_SBR_INVALID_ROUTE_ID;
+    int32              Status;
+    CFE_MSG_Size_t     Size  = 0;
+    CFE_SB_MsgId_t     MsgId = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_Type_t     ContentType;
+    CFE_ES_AppId_t     AppId;
+    CFE_ES_TaskId_t    TskId;
+    char               FullName[(OS_MAX_API_NAME * 2)];
+    CFE_SB_BufferD_t * BufDscPtr;
+    CFE_SBR_RouteId_t  RouteId;
+    CFE_SB_EventBuf_t  SBSndErr;
+    uint16             PendingEventID;
+
+    PendingEventID     = 0;
+    BufDscPtr          = NULL;
+    RouteId            = CFE_SBR_INVALID_ROUTE_ID;
+    AppId              = CFE_ES_APPID_UNDEFINED;
+    TskId              = CFE_ES_TASKID_UNDEFINED;
+    SBSndErr.EvtsToSnd = 0;
 
+    /* Route lookup does not need the SB lock (see CFE_SB_TransmitMsgValidate()) */
     Status = CFE_SB_TransmitMsgValidate(MsgPtr, &MsgId, &Size, &RouteId);
 
+    if (Status == CFE_SUCCESS && !CFE_SBR_IsValidRouteId(RouteId))
+    {
+        /* No subscribers - already counted by the validation, nothing to send */
+        return Status;
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* Gather everything that does not need the lock before taking it */
+        CFE_MSG_GetType(MsgPtr, &ContentType);
+        CFE_SB_GetCallerIdentity(&AppId, &TskId);
+    }
+
+    /*
+     * Allocation and delivery happen under the SB lock, and so does the copy
+     * for small messages, which then cost one lock round trip.  A larger copy
+     * would hold up every other SB user, so it is made with the lock released.
+     */
     CFE_SB_LockSharedData(__func__, __LINE__);
 
-    if (Status == CFE_SUCCESS && CFE_SBR_IsValidRouteId(RouteId))
+    if (Status == CFE_SUCCESS)
     {
         /* Get buffer - note this pre-initializes the returned buffer with
          * a use count of 1, which refers to this task as it fills the buffer. */
@@ -1318,46 +1387,31 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool UpdateHead
         }
     }
 
-    /*
-     * Increment the MsgSendErrorCounter only if there was a real error,
-     * such as a validation issue or failure to allocate a buffer.
-     *
-     * (This should NOT be done if simply no route)
-     */
-    if (Status != CFE_SUCCESS)
-    {
-        CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
-    }
-
-    CFE_SB_UnlockSharedData(__func__, __LINE__);
-
-    /*
-     * If a buffer was obtained above, then copy the content into it
-     * and broadcast it to all subscribers in the route.
-     *
-     * Note - if there is no route / no subscribers, the "Status" will
-     * be CFE_SUCCESS because CFE_SB_TransmitMsgValidate() succeeded,
-     * but there will be no buffer because CFE_SBR_IsValidRouteId() returned
-     * false.
-     *
-     * But if the descriptor is non-null it means the message is valid and
-     * there is a route to send it to.
-     */
     if (BufDscPtr != NULL)
     {
         /* Copy actual message content into buffer and set its metadata */
-        memcpy(&BufDscPtr->Content, MsgPtr, Size);
+        if (Size > CFE_SB_LOCKED_COPY_MAX)
+        {
+            /* Nothing else can reach the buffer before it is broadcast */
+            CFE_SB_UnlockSharedData(__func__, __LINE__);
+            memcpy(&BufDscPtr->Content, MsgPtr, Size);
+            CFE_SB_LockSharedData(__func__, __LINE__);
+        }
+        else
+        {
+            memcpy(&BufDscPtr->Content, MsgPtr, Size);
+        }
         BufDscPtr->MsgId       = MsgId;
         BufDscPtr->ContentSize = Size;
         BufDscPtr->NeedsUpdate = UpdateHeader;
-        CFE_MSG_GetType(MsgPtr, &BufDscPtr->ContentType);
+        BufDscPtr->ContentType = ContentType;
 
         /*
          * This routine will use best-effort to send to all subscribers,
          * increment the buffer use count for every successful delivery,
-         * and send an event/increment counter for any unsuccessful delivery.
+         * and record any unsuccessful delivery for the events below.
          */
-        CFE_SB_BroadcastBufferToRoute(BufDscPtr, RouteId);
+        CFE_SB_BroadcastBufferToRouteUnsync(BufDscPtr, RouteId, AppId, &SBSndErr);
 
         /*
          * The broadcast function consumes the buffer, so it should not be
@@ -1366,11 +1420,27 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool UpdateHead
         BufDscPtr = NULL;
     }
 
-    if (PendingEventID == CFE_SB_GET_BUF_ERR_EID)
+    /*
+     * Increment the MsgSendErrorCounter only if there was a real error,
+     * such as a validation issue or failure to allocate a buffer.
+     *
+     * (This should NOT be done if simply no route)
+     */
+    if (Status != CFE_SUCCESS)
     {
-        /* Get task id for events and Sender Info*/
-        CFE_ES_GetTaskID(&TskId);
+        CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    /* Everything below is the slow path */
+    if (SBSndErr.EvtsToSnd > 0)
+    {
+        CFE_SB_SendBroadcastErrEvents(&SBSndErr, MsgId, TskId);
+    }
 
+    if (PendingEventID == CFE_SB_GET_BUF_ERR_EID)
+    {
         if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_GET_BUF_ERR_EID_BIT) == CFE_SB_GRANTED)
         {
             CFE_EVS_SendEventWithAppID(CFE_SB_GET_BUF_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
@@ -1436,21 +1506,19 @@ int32 CFE_SB_TransmitMsgValidate(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t
 
     if (Status == CFE_SUCCESS)
     {
-        /* check the route, which should be done while locked */
-        CFE_SB_LockSharedData(__func__, __LINE__);
-
-        /* Get the routing id */
+        /* Get the routing id - routes are never removed, so no lock is needed to find one */
         *RouteIdPtr = CFE_SBR_GetRouteId(*MsgIdPtr);
 
         /* if there have been no subscriptions for this pkt, */
         /* increment the dropped pkt cnt, send event and return success */
         if (!CFE_SBR_IsValidRouteId(*RouteIdPtr))
         {
+            CFE_SB_LockSharedData(__func__, __LINE__);
             CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter++;
+            CFE_SB_UnlockSharedData(__func__, __LINE__);
+
             PendingEventID = CFE_SB_SEND_NO_SUBS_EID;
         }
-
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
     }
 
     if (PendingEventID != 0)
@@ -1526,27 +1594,118 @@ int32 CFE_SB_TransmitMsgValidate(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t
  *-----------------------------------------------------------------*/
 void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId)
 {
-    CFE_ES_AppId_t         AppId;
-    CFE_ES_TaskId_t        TskId;
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SB_PipeD_t *       PipeDscPtr;
-    CFE_SB_EventBuf_t      SBSndErr;
-    int32                  OsStatus;
-    uint32                 i;
-    char                   FullName[(OS_MAX_API_NAME * 2)];
-    char                   PipeName[OS_MAX_API_NAME];
+    CFE_ES_AppId_t    AppId;
+    CFE_ES_TaskId_t   TskId;
+    CFE_SB_MsgId_t    MsgId;
+    CFE_SB_EventBuf_t SBSndErr;
 
     SBSndErr.EvtsToSnd = 0;
 
-    /* get app id for loopback testing */
-    CFE_ES_GetAppID(&AppId);
+    /* get app id for loopback testing, task id for events and Sender Info */
+    CFE_SB_GetCallerIdentity(&AppId, &TskId);
 
-    /* get task id for events and Sender Info*/
-    CFE_ES_GetTaskID(&TskId);
+    /* the buffer may be released by a receiver once unlocked, so keep the MsgId for events */
+    MsgId = BufDscPtr->MsgId;
 
     /* take semaphore to prevent a task switch during processing */
     CFE_SB_LockSharedData(__func__, __LINE__);
 
+    CFE_SB_BroadcastBufferToRouteUnsync(BufDscPtr, RouteId, AppId, &SBSndErr);
+
+    /* release the semaphore */
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    if (SBSndErr.EvtsToSnd > 0)
+    {
+        CFE_SB_SendBroadcastErrEvents(&SBSndErr, MsgId, TskId);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_SendBroadcastErrEvents(const CFE_SB_EventBuf_t *SBSndErr, CFE_SB_MsgId_t MsgId, CFE_ES_TaskId_t TskId)
+{
+    uint32 i;
+    char   FullName[(OS_MAX_API_NAME * 2)];
+    char   PipeName[OS_MAX_API_NAME];
+
+    /* send an event for each pipe write error that may have occurred */
+    for (i = 0; i < SBSndErr->EvtsToSnd; i++)
+    {
+        if (SBSndErr->EvtBuf[i].EventId == CFE_SB_MSGID_LIM_ERR_EID)
+        {
+            /* Determine if event can be sent without causing recursive event problem */
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_MSGID_LIM_ERR_EID_BIT) == CFE_SB_GRANTED)
+            {
+                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr->EvtBuf[i].PipeId);
+
+                CFE_ES_PerfLogEntry(CFE_MISSION_SB_MSG_LIM_PERF_ID);
+                CFE_ES_PerfLogExit(CFE_MISSION_SB_MSG_LIM_PERF_ID);
+
+                CFE_EVS_SendEventWithAppID(CFE_SB_MSGID_LIM_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Msg Limit Err,MsgId 0x%x,pipe %s,sender %s",
+                                           (unsigned int)CFE_SB_MsgIdToValue(MsgId), PipeName,
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_MSGID_LIM_ERR_EID_BIT);
+            }
+        }
+        else if (SBSndErr->EvtBuf[i].EventId == CFE_SB_Q_FULL_ERR_EID)
+        {
+            /* Determine if event can be sent without causing recursive event problem */
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_Q_FULL_ERR_EID_BIT) == CFE_SB_GRANTED)
+            {
+                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr->EvtBuf[i].PipeId);
+
+                CFE_ES_PerfLogEntry(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
+                CFE_ES_PerfLogExit(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
+
+                CFE_EVS_SendEventWithAppID(CFE_SB_Q_FULL_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Pipe Overflow,MsgId 0x%x,pipe %s,sender %s",
+                                           (unsigned int)CFE_SB_MsgIdToValue(MsgId), PipeName,
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_Q_FULL_ERR_EID_BIT);
+            }
+        }
+        else
+        {
+            /* Determine if event can be sent without causing recursive event problem */
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_Q_WR_ERR_EID_BIT) == CFE_SB_GRANTED)
+            {
+                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr->EvtBuf[i].PipeId);
+
+                CFE_EVS_SendEventWithAppID(CFE_SB_Q_WR_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Pipe Write Err,MsgId 0x%x,pipe %s,sender %s,stat %ld",
+                                           (unsigned int)CFE_SB_MsgIdToValue(MsgId), PipeName,
+                                           CFE_SB_GetAppTskName(TskId, FullName), (long)(SBSndErr->EvtBuf[i].OsStatus));
+
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_Q_WR_ERR_EID_BIT);
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_BroadcastBufferToRouteUnsync(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId,
+                                         CFE_ES_AppId_t AppId, CFE_SB_EventBuf_t *SBSndErr)
+{
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SB_PipeD_t *       PipeDscPtr;
+    int32                  OsStatus;
+
     /* For an invalid route / no subscribers this whole logic can be skipped */
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
@@ -1589,9 +1748,9 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
             /* and go to next destination */
             if (DestPtr->BuffCount >= DestPtr->MsgId2PipeLim)
             {
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_MSGID_LIM_ERR_EID;
-                SBSndErr.EvtsToSnd++;
+                SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].PipeId  = DestPtr->PipeId;
+                SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].EventId = CFE_SB_MSGID_LIM_ERR_EID;
+                SBSndErr->EvtsToSnd++;
                 CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter++;
                 PipeDscPtr->SendErrors++;
 
@@ -1602,7 +1761,14 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
             ** Write the buffer descriptor to the queue of the pipe.  If the write
             ** failed, log info and increment the pipe's error counter.
             */
-            OsStatus = OS_QueuePut(PipeDscPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), 0);
+            if (PipeDscPtr->Ring != NULL)
+            {
+                OsStatus = CFE_SB_PipeRingPush(PipeDscPtr, BufDscPtr);
+            }
+            else
+            {
+                OsStatus = OS_QueuePut(PipeDscPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), 0);
+            }
 
             if (OsStatus == OS_SUCCESS)
             {
@@ -1619,20 +1785,20 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
             }
             else
             {
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId = DestPtr->PipeId;
+                SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].PipeId = DestPtr->PipeId;
                 if (OsStatus == OS_QUEUE_FULL)
                 {
-                    SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_Q_FULL_ERR_EID;
+                    SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].EventId = CFE_SB_Q_FULL_ERR_EID;
                     CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter++;
                 }
                 else
                 {
                     /* Unexpected error while writing to queue. */
-                    SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId  = CFE_SB_Q_WR_ERR_EID;
-                    SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].OsStatus = OsStatus;
+                    SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].EventId  = CFE_SB_Q_WR_ERR_EID;
+                    SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].OsStatus = OsStatus;
                     CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter++;
                 }
-                SBSndErr.EvtsToSnd++;
+                SBSndErr->EvtsToSnd++;
                 PipeDscPtr->SendErrors++;
             } /*end if */
 
@@ -1643,7 +1809,7 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
      * If any specific delivery issues occurred, also increment the
      * general error count before releasing the lock.
      */
-    if (SBSndErr.EvtsToSnd > 0)
+    if (SBSndErr->EvtsToSnd > 0)
     {
         CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
     }
@@ -1671,67 +1837,41 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
     ** been disabled via ground command.
     */
     CFE_SB_DecrBufUseCnt(BufDscPtr);
+}
 
-    /* release the semaphore */
-    CFE_SB_UnlockSharedData(__func__, __LINE__);
-
-    /* send an event for each pipe write error that may have occurred */
-    for (i = 0; i < SBSndErr.EvtsToSnd; i++)
-    {
-        if (SBSndErr.EvtBuf[i].EventId == CFE_SB_MSGID_LIM_ERR_EID)
-        {
-            /* Determine if event can be sent without causing recursive event problem */
-            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_MSGID_LIM_ERR_EID_BIT) == CFE_SB_GRANTED)
-            {
-                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
-
-                CFE_ES_PerfLogEntry(CFE_MISSION_SB_MSG_LIM_PERF_ID);
-                CFE_ES_PerfLogExit(CFE_MISSION_SB_MSG_LIM_PERF_ID);
-
-                CFE_EVS_SendEventWithAppID(CFE_SB_MSGID_LIM_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                           "Msg Limit Err,MsgId 0x%x,pipe %s,sender %s",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
-                                           CFE_SB_GetAppTskName(TskId, FullName));
-
-                /* clear the bit so the task may send this event again */
-                CFE_SB_FinishSendEvent(TskId, CFE_SB_MSGID_LIM_ERR_EID_BIT);
-            }
-        }
-        else if (SBSndErr.EvtBuf[i].EventId == CFE_SB_Q_FULL_ERR_EID)
-        {
-            /* Determine if event can be sent without causing recursive event problem */
-            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_Q_FULL_ERR_EID_BIT) == CFE_SB_GRANTED)
-            {
-                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
-
-                CFE_ES_PerfLogEntry(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
-                CFE_ES_PerfLogExit(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
-
-                CFE_EVS_SendEventWithAppID(CFE_SB_Q_FULL_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                           "Pipe Overflow,MsgId 0x%x,pipe %s,sender %s",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
-                                           CFE_SB_GetAppTskName(TskId, FullName));
-
-                /* clear the bit so the task may send this event again */
-                CFE_SB_FinishSendEvent(TskId, CFE_SB_Q_FULL_ERR_EID_BIT);
-            }
-        }
-        else
-        {
-            /* Determine if event can be sent without causing recursive event problem */
-            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_Q_WR_ERR_EID_BIT) == CFE_SB_GRANTED)
-            {
-                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_SendReceiveErrEvent(uint16 EventId, CFE_SB_PipeId_t PipeId, const void *BufPtr, int32 TimeOut,
+                                int32 OsStatus)
+{
+    CFE_ES_TaskId_t TskId;
+    char            FullName[(OS_MAX_API_NAME * 2)];
 
-                CFE_EVS_SendEventWithAppID(CFE_SB_Q_WR_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                           "Pipe Write Err,MsgId 0x%x,pipe %s,sender %s,stat %ld",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
-                                           CFE_SB_GetAppTskName(TskId, FullName), (long)(SBSndErr.EvtBuf[i].OsStatus));
+    /* get task id for events */
+    CFE_ES_GetTaskID(&TskId);
 
-                /* clear the bit so the task may send this event again */
-                CFE_SB_FinishSendEvent(TskId, CFE_SB_Q_WR_ERR_EID_BIT);
-            }
-        }
+    switch (EventId)
+    {
+        case CFE_SB_Q_RD_ERR_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_Q_RD_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "Pipe Read Err,pipe %lu,app %s,stat %ld", CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       CFE_SB_GetAppTskName(TskId, FullName), (long)OsStatus);
+            break;
+        case CFE_SB_RCV_BAD_ARG_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_RCV_BAD_ARG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "Rcv Err:Bad Input Arg:BufPtr 0x%lx,pipe %lu,t/o %d,app %s",
+                                       (unsigned long)BufPtr, CFE_RESOURCEID_TO_ULONG(PipeId), (int)TimeOut,
+                                       CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+        case CFE_SB_BAD_PIPEID_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_BAD_PIPEID_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "Rcv Err:PipeId %lu does not exist,app %s", CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       CFE_SB_GetAppTskName(TskId, FullName));
+            break;
     }
 }
 
@@ -1748,13 +1888,10 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     CFE_SB_BufferD_t *     BufDscPtr;
     size_t                 BufDscSize;
     CFE_SB_PipeD_t *       PipeDscPtr;
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SBR_RouteId_t      RouteId;
-    CFE_ES_TaskId_t        TskId;
     uint16                 PendingEventID;
     osal_id_t              SysQueueId;
     int32                  SysTimeout;
-    char                   FullName[(OS_MAX_API_NAME * 2)];
+    bool                   IsRing;
 
     PendingEventID = 0;
     Status         = CFE_SUCCESS;
@@ -1762,9 +1899,9 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     SysQueueId     = OS_OBJECT_ID_UNDEFINED;
     PipeDscPtr     = NULL;
     BufDscPtr      = NULL;
-    DestPtr        = NULL;
     BufDscSize     = 0;
     OsStatus       = OS_SUCCESS;
+    IsRing         = false;
 
     /*
      * Check input args and see if any are bad, which require
@@ -1815,28 +1952,23 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
         {
             /* Grab the queue ID */
             SysQueueId = PipeDscPtr->SysQueueId;
+            IsRing     = (PipeDscPtr->Ring != NULL);
 
             /*
-             * Un-reference any previous buffer from the last call.
+             * Un-reference any previous buffer(s) from the last call.
              *
              * NOTE: This is historical behavior where apps call CFE_SB_ReceiveBuffer()
-             * in the loop within the app's main task.  There is currently no separate
-             * API to "free" or unreference a buffer that was returned from SB.
-             *
-             * Instead, each time this function is invoked, it is implicitly interpreted
-             * as an indication that the caller is done with the previous buffer.
+             * in the loop within the app's main task.  Each time this function is
+             * invoked, it is implicitly interpreted as an indication that the caller
+             * is done with the previous buffer, and CFE_SB_ReleaseBuffers() only
+             * allows the caller to say so sooner.
              *
              * Unfortunately this prevents pipe IDs from being serviced/shared across
              * multiple child tasks in a worker pattern design.  This may be changed
              * in a future version of CFE to decouple these actions, to allow for
              * multiple workers to service the same pipe.
              */
-            if (PipeDscPtr->LastBuffer != NULL)
-            {
-                /* Decrement the Buffer Use Count, which will Free buffer if it becomes 0 */
-                CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
-                PipeDscPtr->LastBuffer = NULL;
-            }
+            CFE_SB_PipeReleaseHeldUnsync(PipeDscPtr);
         }
 
         CFE_SB_UnlockSharedData(__func__, __LINE__);
@@ -1848,8 +1980,17 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
      */
     if (Status == CFE_SUCCESS)
     {
-        /* Read the buffer descriptor address from the queue.  */
-        OsStatus = OS_QueueGet(SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, SysTimeout);
+        if (IsRing)
+        {
+            /* Wait for an entry; it is taken off the ring below, under the lock */
+            OsStatus   = CFE_SB_PipeRingWait(SysQueueId, SysTimeout);
+            BufDscSize = sizeof(BufDscPtr);
+        }
+        else
+        {
+            /* Read the buffer descriptor address from the queue.  */
+            OsStatus = OS_QueueGet(SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, SysTimeout);
+        }
 
         /*
          * translate the return value -
@@ -1857,7 +1998,7 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
          * CFE functions have their own set of RC values should not directly return OSAL codes
          * The size should always match.  If it does not, then generate CFE_SB_Q_RD_ERR_EID.
          */
-        if (OsStatus == OS_SUCCESS && BufDscPtr != NULL && BufDscSize == sizeof(BufDscPtr))
+        if (OsStatus == OS_SUCCESS && (IsRing || BufDscPtr != NULL) && BufDscSize == sizeof(BufDscPtr))
         {
             /* Pass through */
         }
@@ -1882,6 +2023,25 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     /* Now re-lock to store the buffer in the pipe descriptor */
     CFE_SB_LockSharedData(__func__, __LINE__);
 
+    if (Status == CFE_SUCCESS && IsRing)
+    {
+        /* The semaphore count taken above is for one entry on the ring */
+        if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+        {
+            PendingEventID = CFE_SB_BAD_PIPEID_EID;
+            Status         = CFE_SB_PIPE_RD_ERR;
+        }
+        else
+        {
+            BufDscPtr = CFE_SB_PipeRingPop(PipeDscPtr);
+            if (BufDscPtr == NULL)
+            {
+                PendingEventID = CFE_SB_Q_RD_ERR_EID;
+                Status         = CFE_SB_PIPE_RD_ERR;
+            }
+        }
+    }
+
     if (Status == CFE_SUCCESS)
     {
         /*
@@ -1907,25 +2067,7 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
              */
             *BufPtr = &BufDscPtr->Content;
 
-            /* get pointer to destination to be used in decrementing msg limit cnt*/
-            RouteId = CFE_SBR_GetRouteId(BufDscPtr->MsgId);
-            DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId);
-
-            /*
-            ** DestPtr would be NULL if the msg is unsubscribed to while it is on
-            ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
-            ** then resubscribed to while it is on the pipe. Both of these cases are
-            ** considered nominal and are handled by the code below.
-            */
-            if (DestPtr != NULL && DestPtr->BuffCount > 0)
-            {
-                DestPtr->BuffCount--;
-            }
-
-            if (PipeDscPtr->CurrentQueueDepth > 0)
-            {
-                --PipeDscPtr->CurrentQueueDepth;
-            }
+            CFE_SB_PipeDequeuedUnsync(PipeDscPtr, PipeId, BufDscPtr);
         }
         else
         {
@@ -1957,28 +2099,7 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     /* Now actually send the event, after unlocking (do not call EVS with SB locked) */
     if (PendingEventID != 0)
     {
-        /* get task id for events */
-        CFE_ES_GetTaskID(&TskId);
-
-        switch (PendingEventID)
-        {
-            case CFE_SB_Q_RD_ERR_EID:
-                CFE_EVS_SendEventWithAppID(CFE_SB_Q_RD_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                           "Pipe Read Err,pipe %lu,app %s,stat %ld", CFE_RESOURCEID_TO_ULONG(PipeId),
-                                           CFE_SB_GetAppTskName(TskId, FullName), (long)OsStatus);
-                break;
-            case CFE_SB_RCV_BAD_ARG_EID:
-                CFE_EVS_SendEventWithAppID(CFE_SB_RCV_BAD_ARG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                           "Rcv Err:Bad Input Arg:BufPtr 0x%lx,pipe %lu,t/o %d,app %s",
-                                           (unsigned long)BufPtr, CFE_RESOURCEID_TO_ULONG(PipeId), (int)TimeOut,
-                                           CFE_SB_GetAppTskName(TskId, FullName));
-                break;
-            case CFE_SB_BAD_PIPEID_EID:
-                CFE_EVS_SendEventWithAppID(CFE_SB_BAD_PIPEID_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                           "Rcv Err:PipeId %lu does not exist,app %s", CFE_RESOURCEID_TO_ULONG(PipeId),
-                                           CFE_SB_GetAppTskName(TskId, FullName));
-                break;
-        }
+        CFE_SB_SendReceiveErrEvent(PendingEventID, PipeId, BufPtr, TimeOut, OsStatus);
     }
 
     /* If not successful, set the output pointer to NULL */
@@ -1990,6 +2111,258 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_ReceiveBuffers(CFE_SB_Buffer_t **BufPtrs, uint32 *CountPtr, uint32 MaxCount,
+                                   CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    int32             Status;
+    int32             OsStatus;
+    CFE_SB_BufferD_t *BufDscList[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH];
+    CFE_SB_BufferD_t *BufDscPtr;
+    size_t            BufDscSize;
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    uint16            PendingEventID;
+    osal_id_t         SysQueueId;
+    int32             SysTimeout;
+    uint32            Count;
+    uint32            i;
+    bool              IsRing;
+
+    PendingEventID = 0;
+    Status         = CFE_SUCCESS;
+    SysTimeout     = OS_PEND;
+    SysQueueId     = OS_OBJECT_ID_UNDEFINED;
+    PipeDscPtr     = NULL;
+    BufDscPtr      = NULL;
+    BufDscSize     = 0;
+    OsStatus       = OS_SUCCESS;
+    Count          = 0;
+    IsRing         = false;
+
+    /* Check input args and translate the timeout, as CFE_SB_ReceiveBuffer() does */
+    if (BufPtrs == NULL || CountPtr == NULL || MaxCount == 0)
+    {
+        PendingEventID = CFE_SB_RCV_BAD_ARG_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    else if (TimeOut > 0)
+    {
+        SysTimeout = TimeOut;
+    }
+    else if (TimeOut == CFE_SB_POLL)
+    {
+        SysTimeout = OS_CHECK;
+    }
+    else if (TimeOut != CFE_SB_PEND_FOREVER)
+    {
+        PendingEventID = CFE_SB_RCV_BAD_ARG_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+
+    if (MaxCount > CFE_PLATFORM_SB_MAX_RECEIVE_BATCH)
+    {
+        MaxCount = CFE_PLATFORM_SB_MAX_RECEIVE_BATCH;
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+        if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+        {
+            PendingEventID = CFE_SB_BAD_PIPEID_EID;
+            Status         = CFE_SB_BAD_ARGUMENT;
+        }
+        else
+        {
+            SysQueueId = PipeDscPtr->SysQueueId;
+            IsRing     = (PipeDscPtr->Ring != NULL);
+
+            /* As for CFE_SB_ReceiveBuffer(), this call releases the previous one(s) */
+            CFE_SB_PipeReleaseHeldUnsync(PipeDscPtr);
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    /*
+     * Wait once, outside the SB lock, for the first entry.  A ring pipe's
+     * entries are then all taken off below under the lock; a queue pipe's
+     * are read here, without waiting for any after the first.
+     */
+    if (Status == CFE_SUCCESS)
+    {
+        if (IsRing)
+        {
+            OsStatus   = CFE_SB_PipeRingWait(SysQueueId, SysTimeout);
+            BufDscSize = sizeof(BufDscPtr);
+        }
+        else
+        {
+            OsStatus = OS_QueueGet(SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, SysTimeout);
+        }
+
+        if (OsStatus == OS_SUCCESS && (IsRing || BufDscPtr != NULL) && BufDscSize == sizeof(BufDscPtr))
+        {
+            if (!IsRing)
+            {
+                BufDscList[Count++] = BufDscPtr;
+                while (Count < MaxCount)
+                {
+                    BufDscPtr = NULL;
+                    OsStatus  = OS_QueueGet(SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, OS_CHECK);
+                    if (OsStatus == OS_QUEUE_EMPTY)
+                    {
+                        break;
+                    }
+
+                    if (OsStatus != OS_SUCCESS || BufDscPtr == NULL || BufDscSize != sizeof(BufDscPtr))
+                    {
+                        /*
+                         * Reported as CFE_SB_ReceiveBuffer() would, but the
+                         * messages already read are still returned
+                         */
+                        PendingEventID = CFE_SB_Q_RD_ERR_EID;
+                        break;
+                    }
+
+                    BufDscList[Count++] = BufDscPtr;
+                }
+            }
+        }
+        else if (OsStatus == OS_QUEUE_EMPTY)
+        {
+            Status = CFE_SB_NO_MESSAGE;
+        }
+        else if (OsStatus == OS_QUEUE_TIMEOUT)
+        {
+            Status = CFE_SB_TIME_OUT;
+        }
+        else
+        {
+            PendingEventID = CFE_SB_Q_RD_ERR_EID;
+            Status         = CFE_SB_PIPE_RD_ERR;
+        }
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    if (Status == CFE_SUCCESS && !CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+    {
+        PendingEventID = CFE_SB_BAD_PIPEID_EID;
+        Status         = CFE_SB_PIPE_RD_ERR;
+
+        /* Drop the refs that were in the queue */
+        for (i = 0; i < Count; ++i)
+        {
+            CFE_SB_DecrBufUseCnt(BufDscList[i]);
+        }
+        Count = 0;
+    }
+    else if (Status == CFE_SUCCESS && IsRing)
+    {
+        /*
+         * The count taken above is for the first entry; each further one is
+         * only taken off the ring once its own count has been taken, which
+         * cannot block as the entry is already there
+         */
+        BufDscPtr = CFE_SB_PipeRingPop(PipeDscPtr);
+        while (BufDscPtr != NULL)
+        {
+            BufDscList[Count++] = BufDscPtr;
+            BufDscPtr           = NULL;
+
+            if (Count < MaxCount && PipeDscPtr->RingCount > 0 && OS_CountSemTimedWait(SysQueueId, 0) == OS_SUCCESS)
+            {
+                BufDscPtr = CFE_SB_PipeRingPop(PipeDscPtr);
+            }
+        }
+
+        if (Count == 0)
+        {
+            PendingEventID = CFE_SB_Q_RD_ERR_EID;
+            Status         = CFE_SB_PIPE_RD_ERR;
+        }
+    }
+
+    /* The pipe keeps the ref each buffer had in the queue until it is released */
+    for (i = 0; i < Count; ++i)
+    {
+        CFE_SB_PipeDequeuedUnsync(PipeDscPtr, PipeId, BufDscList[i]);
+        PipeDscPtr->Batch[i] = BufDscList[i];
+        BufPtrs[i]           = &BufDscList[i]->Content;
+    }
+
+    if (Count > 0)
+    {
+        PipeDscPtr->BatchCount = Count;
+    }
+
+    /*
+     * Before unlocking, increment relevant error counter if needed.  Every
+     * error has a pending event, including a bad queue entry that only cut
+     * the batch short, so the event decides.
+     */
+    if (PendingEventID == CFE_SB_RCV_BAD_ARG_EID || PendingEventID == CFE_SB_BAD_PIPEID_EID)
+    {
+        ++CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter;
+    }
+    else if (PendingEventID != 0)
+    {
+        ++CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    /* Now actually send the event, after unlocking (do not call EVS with SB locked) */
+    if (PendingEventID != 0)
+    {
+        CFE_SB_SendReceiveErrEvent(PendingEventID, PipeId, BufPtrs, TimeOut, OsStatus);
+    }
+
+    if (CountPtr != NULL)
+    {
+        *CountPtr = Count;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_ReleaseBuffers(CFE_SB_PipeId_t PipeId)
+{
+    CFE_SB_PipeD_t *PipeDscPtr;
+    int32           Status;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+    {
+        CFE_SB_PipeReleaseHeldUnsync(PipeDscPtr);
+        Status = CFE_SUCCESS;
+    }
+    else
+    {
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
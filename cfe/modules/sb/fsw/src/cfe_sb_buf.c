@@ -92,19 +92,99 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
+uint8 CFE_SB_GetSizeClass(size_t Size)
+{
+    uint8 SizeClass;
+
+    /* Bucket sizes are listed largest first, so search from the end for the smallest fit */
+    for (SizeClass = CFE_PLATFORM_ES_POOL_MAX_BUCKETS; SizeClass > 0; --SizeClass)
+    {
+        if (CFE_SB_MemPoolDefSize[SizeClass - 1] >= Size)
+        {
+            return SizeClass - 1;
+        }
+    }
+
+    return CFE_SB_SIZE_CLASS_NONE;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void *CFE_SB_GetPoolBlock(size_t Size, uint8 *SizeClassPtr)
 {
-    int32               stat1;
-    size_t              AllocSize;
+    int32               Stat;
+    uint8               SizeClass;
     CFE_ES_MemPoolBuf_t addr = NULL;
-    CFE_SB_BufferD_t *  bd;
+    CFE_SB_FreeBlock_t *Block;
+
+    SizeClass     = CFE_SB_GetSizeClass(Size);
+    *SizeClassPtr = SizeClass;
+
+    if (SizeClass == CFE_SB_SIZE_CLASS_NONE)
+    {
+        /* Larger than every bucket - let ES decide */
+        Stat = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, Size);
+        return (Stat < 0) ? NULL : (void *)addr;
+    }
+
+    Block = CFE_SB_Global.Mem.FreeList[SizeClass];
+    if (Block != NULL)
+    {
+        CFE_SB_Global.Mem.FreeList[SizeClass] = Block->Next;
+        --CFE_SB_Global.Mem.FreeCount[SizeClass];
+        return Block;
+    }
+
+    Stat = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, CFE_SB_MemPoolDefSize[SizeClass]);
+    return (Stat < 0) ? NULL : (void *)addr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PutPoolBlock(void *Block, uint8 SizeClass)
+{
+    CFE_SB_FreeBlock_t *FreeBlock;
+
+    if (SizeClass >= CFE_SB_SIZE_CLASS_NONE)
+    {
+        CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, Block);
+        return;
+    }
+
+    FreeBlock       = Block;
+    FreeBlock->Next = CFE_SB_Global.Mem.FreeList[SizeClass];
+
+    CFE_SB_Global.Mem.FreeList[SizeClass] = FreeBlock;
+    ++CFE_SB_Global.Mem.FreeCount[SizeClass];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
+{
+    size_t            AllocSize;
+    uint8             SizeClass;
+    void *            addr;
+    CFE_SB_BufferD_t *bd;
 
     /* The allocation needs to include enough space for the descriptor object */
     AllocSize = MaxMsgSize + CFE_SB_BUFFERD_CONTENT_OFFSET;
 
     /* Allocate a new buffer descriptor from the SB memory pool.*/
-    stat1 = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, AllocSize);
-    if (stat1 < 0)
+    addr = CFE_SB_GetPoolBlock(AllocSize, &SizeClass);
+    if (addr == NULL)
     {
         return NULL;
     }
@@ -131,6 +211,7 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
     bd->MsgId         = CFE_SB_INVALID_MSG_ID;
     bd->UseCount      = 1;
     bd->AllocatedSize = AllocSize;
+    bd->SizeClass     = SizeClass;
 
     CFE_SB_TrackingListReset(&bd->Link);
 
@@ -152,7 +233,7 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd)
     CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= bd->AllocatedSize;
 
     /* finally give the buf descriptor back to the buf descriptor pool */
-    CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+    CFE_SB_PutPoolBlock(bd, bd->SizeClass);
 }
 
 /*----------------------------------------------------------------
@@ -198,19 +279,19 @@ void CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd)
  *-----------------------------------------------------------------*/
 CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
 {
-    int32               Stat;
-    CFE_ES_MemPoolBuf_t addr = NULL;
+    uint8 SizeClass;
+    void *addr;
 
     /* Allocate a new destination descriptor from the SB memory pool.*/
-    Stat = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, sizeof(CFE_SB_DestinationD_t));
-    if (Stat < 0)
+    addr = CFE_SB_GetPoolBlock(sizeof(CFE_SB_DestinationD_t), &SizeClass);
+    if (addr == NULL)
     {
         return NULL;
     }
 
     /* Add the size of a destination descriptor to the memory-in-use ctr and */
     /* adjust the high water mark if needed */
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse += Stat;
+    CFE_SB_Global.StatTlmMsg.Payload.MemInUse += sizeof(CFE_SB_DestinationD_t);
     if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
     {
         CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
@@ -227,20 +308,16 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
  *-----------------------------------------------------------------*/
 int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest)
 {
-    int32 Stat;
-
     if (Dest == NULL)
     {
         return CFE_SB_BAD_ARGUMENT;
     }
 
     /* give the destination block back to the SB memory pool */
-    Stat = CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, Dest);
-    if (Stat > 0)
-    {
-        /* Subtract the size of the destination block from the Memory in use ctr */
-        CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= Stat;
-    }
+    CFE_SB_PutPoolBlock(Dest, CFE_SB_GetSizeClass(sizeof(CFE_SB_DestinationD_t)));
+
+    /* Subtract the size of the destination block from the Memory in use ctr */
+    CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= sizeof(CFE_SB_DestinationD_t);
 
     return CFE_SUCCESS;
 }
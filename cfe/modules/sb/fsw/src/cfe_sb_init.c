@@ -70,6 +70,9 @@ int32 CFE_SB_EarlyInit(void)
     /* Initialize the state of subscription reporting */
     CFE_SB_Global.SubscriptionReporting = CFE_SB_DISABLE;
 
+    /* Select the pipe implementation */
+    CFE_SB_Global.UseRingPipes = CFE_PLATFORM_SB_RING_PIPES;
+
     /* Initialize memory partition. */
     Stat = CFE_SB_InitBuffers();
     if (Stat != CFE_SUCCESS)
@@ -119,6 +122,10 @@ int32 CFE_SB_InitBuffers(void)
     CFE_SB_TrackingListReset(&CFE_SB_Global.InTransitList);
     CFE_SB_TrackingListReset(&CFE_SB_Global.ZeroCopyList);
 
+    /* The free lists refer to blocks of the pool just replaced */
+    memset(CFE_SB_Global.Mem.FreeList, 0, sizeof(CFE_SB_Global.Mem.FreeList));
+    memset(CFE_SB_Global.Mem.FreeCount, 0, sizeof(CFE_SB_Global.Mem.FreeCount));
+
     return CFE_SUCCESS;
 }
 
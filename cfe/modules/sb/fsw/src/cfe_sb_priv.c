@@ -470,3 +470,190 @@ int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId)
 
     return CFE_SUCCESS;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_GetCallerIdentity(CFE_ES_AppId_t *AppIdPtr, CFE_ES_TaskId_t *TaskIdPtr)
+{
+    osal_id_t              OsTaskId;
+    osal_index_t           Idx;
+    CFE_SB_TaskIdentity_t *IdentPtr;
+
+    OsTaskId = OS_TaskGetId();
+
+    if (!OS_ObjectIdDefined(OsTaskId) ||
+        OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, OsTaskId, &Idx) != OS_SUCCESS || Idx >= OS_MAX_TASKS)
+    {
+        CFE_ES_GetAppID(AppIdPtr);
+        CFE_ES_GetTaskID(TaskIdPtr);
+        return;
+    }
+
+    /*
+     * Only the task holding this OSAL slot touches the entry, and a task's
+     * IDs never change, so no lock is needed.  A task that reuses the slot
+     * has a different OSAL ID and refills it.
+     */
+    IdentPtr = &CFE_SB_Global.TaskIdentity[Idx];
+    if (!OS_ObjectIdEqual(IdentPtr->OsTaskId, OsTaskId))
+    {
+        IdentPtr->OsTaskId = OS_OBJECT_ID_UNDEFINED;
+
+        /* Only cache once ES knows the task; a child task may run before it is registered */
+        if (CFE_ES_GetAppID(&IdentPtr->AppId) == CFE_SUCCESS && CFE_ES_GetTaskID(&IdentPtr->TaskId) == CFE_SUCCESS)
+        {
+            IdentPtr->OsTaskId = OsTaskId;
+        }
+    }
+
+    *AppIdPtr  = IdentPtr->AppId;
+    *TaskIdPtr = IdentPtr->TaskId;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_PipeRingPush(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_BufferD_t *BufDscPtr)
+{
+    int32  OsStatus;
+    uint32 Slot;
+
+    if (PipeDscPtr->RingCount >= PipeDscPtr->MaxQueueDepth)
+    {
+        return OS_QUEUE_FULL;
+    }
+
+    Slot = PipeDscPtr->RingHead + PipeDscPtr->RingCount;
+    if (Slot >= PipeDscPtr->MaxQueueDepth)
+    {
+        Slot -= PipeDscPtr->MaxQueueDepth;
+    }
+
+    /*
+     * The receiver cannot pop before the SB lock is released, so give first:
+     * if that fails the ring is left as it was
+     */
+    OsStatus = OS_CountSemGive(PipeDscPtr->SysQueueId);
+    if (OsStatus == OS_SUCCESS)
+    {
+        PipeDscPtr->Ring[Slot] = BufDscPtr;
+        ++PipeDscPtr->RingCount;
+    }
+
+    return OsStatus;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufferD_t *CFE_SB_PipeRingPop(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    CFE_SB_BufferD_t *BufDscPtr;
+
+    if (PipeDscPtr->RingCount == 0)
+    {
+        return NULL;
+    }
+
+    BufDscPtr = PipeDscPtr->Ring[PipeDscPtr->RingHead];
+
+    ++PipeDscPtr->RingHead;
+    if (PipeDscPtr->RingHead >= PipeDscPtr->MaxQueueDepth)
+    {
+        PipeDscPtr->RingHead = 0;
+    }
+    --PipeDscPtr->RingCount;
+
+    return BufDscPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_PipeRingWait(osal_id_t SysSemId, int32 SysTimeout)
+{
+    int32 OsStatus;
+
+    if (SysTimeout == OS_PEND)
+    {
+        OsStatus = OS_CountSemTake(SysSemId);
+    }
+    else
+    {
+        /* OS_CHECK is 0, which polls */
+        OsStatus = OS_CountSemTimedWait(SysSemId, (uint32)SysTimeout);
+    }
+
+    if (OsStatus == OS_SEM_TIMEOUT)
+    {
+        OsStatus = (SysTimeout == OS_CHECK) ? OS_QUEUE_EMPTY : OS_QUEUE_TIMEOUT;
+    }
+
+    return OsStatus;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PipeReleaseHeldUnsync(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    /* Decrement the Buffer Use Counts, which will Free buffers that become 0 */
+    if (PipeDscPtr->LastBuffer != NULL)
+    {
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
+        PipeDscPtr->LastBuffer = NULL;
+    }
+
+    while (PipeDscPtr->BatchCount > 0)
+    {
+        --PipeDscPtr->BatchCount;
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->Batch[PipeDscPtr->BatchCount]);
+        PipeDscPtr->Batch[PipeDscPtr->BatchCount] = NULL;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PipeDequeuedUnsync(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_PipeId_t PipeId, CFE_SB_BufferD_t *BufDscPtr)
+{
+    CFE_SB_DestinationD_t *DestPtr;
+
+    /* get pointer to destination to be used in decrementing msg limit cnt*/
+    DestPtr = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(BufDscPtr->MsgId), PipeId);
+
+    /*
+    ** DestPtr would be NULL if the msg is unsubscribed to while it is on
+    ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
+    ** then resubscribed to while it is on the pipe. Both of these cases are
+    ** considered nominal and are handled by the code below.
+    */
+    if (DestPtr != NULL && DestPtr->BuffCount > 0)
+    {
+        DestPtr->BuffCount--;
+    }
+
+    if (PipeDscPtr->CurrentQueueDepth > 0)
+    {
+        --PipeDscPtr->CurrentQueueDepth;
+    }
+}
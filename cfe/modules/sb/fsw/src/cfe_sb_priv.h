@@ -87,6 +87,15 @@
 #define CFE_SB_USECNT_ERR    (-3)
 #define CFE_SB_FILE_IO_ERR   (-5)
 
+/* size class of pool blocks too large for any bucket, which bypass the free lists */
+#define CFE_SB_SIZE_CLASS_NONE CFE_PLATFORM_ES_POOL_MAX_BUCKETS
+
+/* ring storage per pipe, a single unused slot when ring pipes are configured out */
+#define CFE_SB_PIPE_RING_SLOTS (CFE_PLATFORM_SB_RING_PIPES ? OS_QUEUE_MAX_DEPTH : 1)
+
+/* largest message TransmitMsg copies while holding the SB lock; larger ones are copied unlocked */
+#define CFE_SB_LOCKED_COPY_MAX 256
+
 /* bit map for stopping recursive event problem */
 #define CFE_SB_SEND_NO_SUBS_EID_BIT   0
 #define CFE_SB_GET_BUF_ERR_EID_BIT    1
@@ -150,7 +159,8 @@ typedef struct CFE_SB_BufferD
     size_t         ContentSize;   /**< Actual size of message content currently stored in the buffer */
     CFE_MSG_Type_t ContentType;   /**< Type of message content currently stored in the buffer */
 
-    bool NeedsUpdate; /**< If message should get its header fields automatically updated */
+    bool  NeedsUpdate; /**< If message should get its header fields automatically updated */
+    uint8 SizeClass;   /**< Free list the block returns to, see CFE_SB_GetPoolBlock() */
 
     uint16 UseCount; /**< Number of active references to this buffer in the system */
 
@@ -163,32 +173,68 @@ typedef struct CFE_SB_BufferD
 **  Purpose:
 **     This structure defines a pipe descriptor used to specify the
 **     characteristics and status of a pipe.
+**
+**     A pipe is either an OSAL queue of buffer descriptor pointers or, if
+**     Ring is set, a ring of them in SB memory (see CFE_SB_PipeRingPush()).
+**     SysQueueId is the OSAL object that carries the pipe name: the queue,
+**     or the counting semaphore that wakes the receiver of a ring pipe.
+**
+**     LastBuffer and Batch hold the references to the buffers handed out by
+**     CFE_SB_ReceiveBuffer() and CFE_SB_ReceiveBuffers() respectively, until
+**     the next receive or CFE_SB_ReleaseBuffers() on the pipe.
 */
 
 typedef struct
 {
-    CFE_SB_PipeId_t   PipeId;
-    uint8             Opts;
-    uint8             Spare;
-    CFE_ES_AppId_t    AppId;
-    osal_id_t         SysQueueId;
-    uint16            SendErrors;
-    uint16            MaxQueueDepth;
-    uint16            CurrentQueueDepth;
-    uint16            PeakQueueDepth;
-    CFE_SB_BufferD_t *LastBuffer;
+    CFE_SB_PipeId_t    PipeId;
+    uint8              Opts;
+    uint8              Spare;
+    CFE_ES_AppId_t     AppId;
+    osal_id_t          SysQueueId;
+    uint16             SendErrors;
+    uint16             MaxQueueDepth;
+    uint16             CurrentQueueDepth;
+    uint16             PeakQueueDepth;
+    CFE_SB_BufferD_t * LastBuffer;
+    CFE_SB_BufferD_t **Ring;                                     /**< Ring storage, NULL for a queue pipe */
+    uint16             RingHead;                                 /**< Ring slot of the oldest entry */
+    uint16             RingCount;                                /**< Entries on the ring */
+    uint16             BatchCount;                               /**< Buffers held from CFE_SB_ReceiveBuffers() */
+    CFE_SB_BufferD_t * Batch[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH]; /**< Those buffers, released on the next receive */
 } CFE_SB_PipeD_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_FreeBlock_t
+**
+**  Purpose:
+**     Link stored in the first bytes of a pool block while it sits on one
+**     of the SB free lists.
+*/
+typedef struct CFE_SB_FreeBlock
+{
+    struct CFE_SB_FreeBlock *Next;
+} CFE_SB_FreeBlock_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_BufParams_t
 **
 **  Purpose:
 **     This structure defines the variables related to the SB routing buffers.
+**
+**     Blocks that SB is done with are kept on a free list per pool block size
+**     (size class) instead of going back to ES, and are handed out again
+**     before the pool is asked for a new one.  The ES pool never gives a
+**     block to a different size once carved, so this holds no memory that
+**     the pool could otherwise have used; the pool's own statistics simply
+**     count free-listed blocks as allocated.
 */
 typedef struct
 {
     CFE_ES_MemHandle_t PoolHdl;
     CFE_ES_STATIC_POOL_TYPE(CFE_PLATFORM_SB_BUF_MEMORY_BYTES) Partition;
+
+    CFE_SB_FreeBlock_t *FreeList[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];  /**< Free blocks, by size class */
+    uint32              FreeCount[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Length of each free list */
 } CFE_SB_MemParams_t;
 
 /*******************************************************************************/
@@ -227,6 +273,21 @@ typedef struct
     CFE_SB_BackgroundFileBuffer_t Buffer;    /**< Temporary holding area for file record */
 } CFE_SB_BackgroundFileStateInfo_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_TaskIdentity_t
+**
+**  Purpose:
+**     ES identity of a sending task, cached by OSAL task slot so the
+**     transmit path does not ask ES (and take its lock) for every message.
+**     The entry is valid while OsTaskId matches the calling task.
+*/
+typedef struct
+{
+    osal_id_t       OsTaskId;
+    CFE_ES_TaskId_t TaskId;
+    CFE_ES_AppId_t  AppId;
+} CFE_SB_TaskIdentity_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_Global_t
 **
@@ -239,7 +300,10 @@ typedef struct
     uint32                       SubscriptionReporting;
     CFE_ES_AppId_t               AppId;
     uint32                       StopRecurseFlags[OS_MAX_TASKS];
+    CFE_SB_TaskIdentity_t        TaskIdentity[OS_MAX_TASKS];
     CFE_SB_PipeD_t               PipeTbl[CFE_PLATFORM_SB_MAX_PIPES];
+    CFE_SB_BufferD_t *           PipeRing[CFE_PLATFORM_SB_MAX_PIPES][CFE_SB_PIPE_RING_SLOTS];
+    bool                         UseRingPipes; /**< New pipes are rings, see #CFE_PLATFORM_SB_RING_PIPES */
     CFE_SB_HousekeepingTlm_t     HKTlmMsg;
     CFE_SB_StatsTlm_t            StatTlmMsg;
     CFE_SB_PipeId_t              CmdPipe;
@@ -414,6 +478,9 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
 /**
  * \brief Internal routine to validate a transmit message before sending
  *
+ * Resolves the route without the SB lock, which is only taken to count a
+ * message that has no subscribers.
+ *
  * \param[in]  MsgPtr     Pointer to the message to validate
  * \param[out] MsgIdPtr   Message Id of message
  * \param[out] SizePtr    Size of message
@@ -543,6 +610,44 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void);
  */
 int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets the size class for a block of Size bytes
+ *
+ * \param[in] Size Number of bytes needed
+ * \returns Index in CFE_SB_MemPoolDefSize of the smallest pool block size that
+ *          fits, or #CFE_SB_SIZE_CLASS_NONE if none does
+ */
+uint8 CFE_SB_GetSizeClass(size_t Size);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets a block of at least Size bytes, from the SB free lists if possible
+ *
+ * A block taken from ES is requested at the full size of its class (see
+ * CFE_SB_GetSizeClass()) so it can later serve any request of that class.
+ * Sizes beyond the largest class are passed to ES as is and are never
+ * free-listed.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in]  Size         Number of bytes needed
+ * \param[out] SizeClassPtr Class to pass to CFE_SB_PutPoolBlock() with the block
+ * \returns Pointer to the block, or NULL if the pool is exhausted
+ */
+void *CFE_SB_GetPoolBlock(size_t Size, uint8 *SizeClassPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Puts a block obtained from CFE_SB_GetPoolBlock() on its free list
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] Block     Block to release
+ * \param[in] SizeClass Class returned with the block
+ */
+void CFE_SB_PutPoolBlock(void *Block, uint8 SizeClass);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief For SB buffer tracking, get first/next position in a list
@@ -654,6 +759,142 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
  */
 void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Broadcast a SB buffer descriptor to all destinations in route, without locking
+ *
+ * The part of CFE_SB_BroadcastBufferToRoute() that runs under the SB lock, for callers
+ * that already hold it.  Consumes the caller's reference to the buffer in the same way.
+ * Delivery failures are counted and recorded in SBSndErr, but no events are sent; the
+ * caller passes SBSndErr to CFE_SB_SendBroadcastErrEvents() after unlocking.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in]  BufDscPtr Pointer to the buffer descriptor to broadcast
+ * \param[in]  RouteId   Route to send to
+ * \param[in]  AppId     Sending application, for pipes that ignore their own messages
+ * \param[out] SBSndErr  Delivery failures to report
+ */
+void CFE_SB_BroadcastBufferToRouteUnsync(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId,
+                                         CFE_ES_AppId_t AppId, CFE_SB_EventBuf_t *SBSndErr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Send the events for delivery failures recorded during a broadcast
+ *
+ * @note This must be invoked without holding the SB global lock
+ *
+ * \param[in] SBSndErr Failures recorded by CFE_SB_BroadcastBufferToRouteUnsync()
+ * \param[in] MsgId    Message ID that was broadcast
+ * \param[in] TskId    Sending task
+ */
+void CFE_SB_SendBroadcastErrEvents(const CFE_SB_EventBuf_t *SBSndErr, CFE_SB_MsgId_t MsgId, CFE_ES_TaskId_t TskId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get the ES app and task IDs of the calling task
+ *
+ * Same result as CFE_ES_GetAppID() and CFE_ES_GetTaskID(), but ES is only
+ * asked the first time a task calls; after that the IDs come from
+ * CFE_SB_Global.TaskIdentity.  Does not take the SB lock.
+ *
+ * \param[out] AppIdPtr  Calling app, undefined if ES does not know the task
+ * \param[out] TaskIdPtr Calling task, undefined if ES does not know the task
+ */
+void CFE_SB_GetCallerIdentity(CFE_ES_AppId_t *AppIdPtr, CFE_ES_TaskId_t *TaskIdPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Appends a buffer descriptor to a ring pipe and wakes its receiver
+ *
+ * The ring is only touched under the SB lock, so any number of senders may
+ * push while the receiver pops.  Each entry is matched by one count on the
+ * pipe's semaphore, which the receiver takes before popping.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] PipeDscPtr Ring pipe to append to
+ * \param[in] BufDscPtr  Buffer to append; the caller accounts for the new reference
+ *
+ * \return OSAL status, as OS_QueuePut() would give: #OS_SUCCESS, #OS_QUEUE_FULL
+ *         if the pipe already holds MaxQueueDepth entries, or the semaphore error
+ */
+int32 CFE_SB_PipeRingPush(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_BufferD_t *BufDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Removes the oldest buffer descriptor from a ring pipe
+ *
+ * Does not touch the semaphore; the receiver has already taken the count
+ * for this entry.  The reference held by the ring passes to the caller.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] PipeDscPtr Ring pipe to remove from
+ * \returns The buffer descriptor, or NULL if the ring is empty
+ */
+CFE_SB_BufferD_t *CFE_SB_PipeRingPop(CFE_SB_PipeD_t *PipeDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Waits for an entry on a ring pipe
+ *
+ * Takes one count from the pipe's semaphore.  Called without the SB lock,
+ * as it may block; the entry is then removed with CFE_SB_PipeRingPop().
+ *
+ * \param[in] SysSemId   Semaphore of the ring pipe
+ * \param[in] SysTimeout OS_PEND, OS_CHECK or a timeout in milliseconds, as for OS_QueueGet()
+ *
+ * \return OSAL status, as OS_QueueGet() would give: #OS_SUCCESS, #OS_QUEUE_EMPTY,
+ *         #OS_QUEUE_TIMEOUT, or the semaphore error
+ */
+int32 CFE_SB_PipeRingWait(osal_id_t SysSemId, int32 SysTimeout);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Releases the buffers a pipe's receiver was last given
+ *
+ * Drops the references held in LastBuffer and Batch, freeing any buffer
+ * that no other pipe still holds.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] PipeDscPtr Pipe to release the buffers of
+ */
+void CFE_SB_PipeReleaseHeldUnsync(CFE_SB_PipeD_t *PipeDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Accounts for a buffer taken off a pipe by its receiver
+ *
+ * Lowers the pipe's current depth and the message limit count of the
+ * buffer's destination, if it is still subscribed.  The reference the
+ * pipe held is left for the caller to keep or drop.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] PipeDscPtr Pipe the buffer was taken from
+ * \param[in] PipeId     ID of that pipe
+ * \param[in] BufDscPtr  Buffer taken off the pipe
+ */
+void CFE_SB_PipeDequeuedUnsync(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_PipeId_t PipeId, CFE_SB_BufferD_t *BufDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Sends the error event for a failed receive
+ *
+ * Shared by CFE_SB_ReceiveBuffer() and CFE_SB_ReceiveBuffers().  Must be
+ * called without the SB lock held.
+ *
+ * \param[in] EventId  CFE_SB_Q_RD_ERR_EID, CFE_SB_RCV_BAD_ARG_EID or CFE_SB_BAD_PIPEID_EID
+ * \param[in] PipeId   Pipe the receive was for
+ * \param[in] BufPtr   Output pointer the caller passed, for the bad argument event
+ * \param[in] TimeOut  Timeout the caller passed, for the bad argument event
+ * \param[in] OsStatus OSAL status of the failed read, for the read error event
+ */
+void CFE_SB_SendReceiveErrEvent(uint16 EventId, CFE_SB_PipeId_t PipeId, const void *BufPtr, int32 TimeOut,
+                                int32 OsStatus);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Perform basic sanity check on the Zero Copy handle
@@ -1053,4 +1294,6 @@ void CFE_SB_BackgroundFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event
 
 extern CFE_SB_Global_t CFE_SB_Global;
 
+extern const size_t CFE_SB_MemPoolDefSize[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+
 #endif /* CFE_SB_PRIV_H */
@@ -44,6 +44,10 @@
 #error CFE_PLATFORM_SB_MAX_PIPES cannot be greater than OS_MAX_QUEUES!
 #endif
 
+#if CFE_PLATFORM_SB_RING_PIPES && CFE_PLATFORM_SB_MAX_PIPES > OS_MAX_COUNT_SEMAPHORES
+#error CFE_PLATFORM_SB_MAX_PIPES cannot be greater than OS_MAX_COUNT_SEMAPHORES when CFE_PLATFORM_SB_RING_PIPES is true!
+#endif
+
 #if CFE_PLATFORM_SB_MAX_DEST_PER_PKT < 1
 #error CFE_PLATFORM_SB_MAX_DEST_PER_PKT cannot be less than 1!
 #endif
@@ -64,6 +68,14 @@
 #error CFE_PLATFORM_SB_BUF_MEMORY_BYTES cannot be greater than UINT32_MAX (4 Gigabytes)!
 #endif
 
+#if CFE_PLATFORM_SB_MAX_RECEIVE_BATCH < 1
+#error CFE_PLATFORM_SB_MAX_RECEIVE_BATCH cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_RECEIVE_BATCH > 65535
+#error CFE_PLATFORM_SB_MAX_RECEIVE_BATCH cannot be greater than 65535!
+#endif
+
 /*
  * Legacy time formats no longer supported in core cFE, this will pass
  * if default is selected or if both defines are removed
@@ -220,6 +220,9 @@ void SB_ResetUnitTest(void)
 {
     UT_InitData();
     CFE_SB_EarlyInit();
+
+    /* Most cases are written against the OS_Queue stubs; ring pipe cases opt in */
+    CFE_SB_Global.UseRingPipes = false;
 }
 
 /*
@@ -431,6 +434,7 @@ void Test_SB_Main_Nominal(void)
     Buffer.Desc.UseCount      = 1;
     Buffer.Desc.AllocatedSize = sizeof(Buffer);
     Buffer.Desc.ContentSize   = Size;
+    Buffer.Desc.SizeClass     = CFE_SB_SIZE_CLASS_NONE; /* not from the pool, so keep it off the free lists */
     CFE_SB_TrackingListReset(&Buffer.Desc.Link);
     UT_SetHandlerFunction(UT_KEY(OS_QueueGet), SB_UT_PipeGetHandler, &Buffer);
     /* This still needs to error-out to avoid an infinite loop */
@@ -2855,6 +2859,8 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_PipeFull);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_MsgLimitExceeded);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_GetPoolBufErr);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsg_SingleLock);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsg_LargeCopyUnlocked);
     SB_UT_ADD_SUBTEST(Test_TransmitBuffer_IncrementSeqCnt);
     SB_UT_ADD_SUBTEST(Test_TransmitBuffer_NoIncrement);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_ZeroCopyBufferValidate);
@@ -2862,6 +2868,7 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_BroadcastBufferToRoute);
     SB_UT_ADD_SUBTEST(Test_TransmitMsgValidate_MaxMsgSizePlusOne);
     SB_UT_ADD_SUBTEST(Test_TransmitMsgValidate_NoSubscribers);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsgValidate_Routed);
     SB_UT_ADD_SUBTEST(Test_TransmitMsgValidate_InvalidMsgId);
     SB_UT_ADD_SUBTEST(Test_AllocateMessageBuffer);
     SB_UT_ADD_SUBTEST(Test_ReleaseMessageBuffer);
@@ -3165,6 +3172,7 @@ void Test_TransmitMsg_GetPoolBufErr(void)
     SB_UT_Test_Tlm_t TlmPkt;
     int32            PipeDepth;
     CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
 
     memset(&TlmPkt, 0, sizeof(TlmPkt));
 
@@ -3173,6 +3181,7 @@ void Test_TransmitMsg_GetPoolBufErr(void)
     CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
 
     /* Have GetPoolBuf stub return error on its next call (buf descriptor
      * allocation failed)
@@ -3186,6 +3195,7 @@ void Test_TransmitMsg_GetPoolBufErr(void)
     /* Repeat buf descriptor allocation failed with event denied */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_TaskID_ToIndex), 1, -1);
     UtAssert_INT32_EQ(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true), CFE_SB_BUF_ALOC_ERR);
@@ -3196,6 +3206,94 @@ void Test_TransmitMsg_GetPoolBufErr(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test that a routed message is sent under a single SB lock
+*/
+void Test_TransmitMsg_SingleLock(void)
+{
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t   MsgId  = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    uint32           LockCount;
+    uint32           AppIdCount;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "SingleLockPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+
+    LockCount = UT_GetStubCount(UT_KEY(OS_MutSemTake));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemTake)), LockCount + 1);
+
+    /* The sender's identity is cached, so the second send does not ask ES */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+
+    LockCount  = UT_GetStubCount(UT_KEY(OS_MutSemTake));
+    AppIdCount = UT_GetStubCount(UT_KEY(CFE_ES_GetAppID));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemTake)), LockCount + 1);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_ES_GetAppID)), AppIdCount);
+
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 0);
+    CFE_UtAssert_EVENTCOUNT(2);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test that a large message is copied with the SB lock released
+*/
+void Test_TransmitMsg_LargeCopyUnlocked(void)
+{
+    CFE_SB_PipeId_t PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t  MsgId  = SB_UT_TLM_MID;
+    struct
+    {
+        CFE_MSG_TelemetryHeader_t TelemetryHeader;
+        uint8                     Data[CFE_SB_LOCKED_COPY_MAX];
+    } LargePkt;
+    CFE_MSG_Size_t   Size = sizeof(LargePkt);
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_SB_Buffer_t *SBBufPtr;
+    uint32           LockCount;
+    uint32           UnlockCount;
+
+    memset(&LargePkt, 0, sizeof(LargePkt));
+    memset(LargePkt.Data, 0xA5, sizeof(LargePkt.Data));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "LargeCopyPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+
+    /* Allocation and delivery each take the lock, the copy in between does not */
+    LockCount   = UT_GetStubCount(UT_KEY(OS_MutSemTake));
+    UnlockCount = UT_GetStubCount(UT_KEY(OS_MutSemGive));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(LargePkt.TelemetryHeader), true));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemTake)), LockCount + 2);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemGive)), UnlockCount + 2);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_MemCmp(SBBufPtr, &LargePkt, sizeof(LargePkt), "Large message content");
+
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 0);
+    CFE_UtAssert_EVENTCOUNT(2);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
 /*
 ** Test getting a pointer to a buffer for zero copy mode with buffer
 ** allocation failures
@@ -3470,7 +3568,8 @@ void Test_BroadcastBufferToRoute(void)
     CFE_SBR_RouteId_t RouteId;
 
     memset(&SBBufD, 0, sizeof(SBBufD));
-    SBBufD.MsgId = MsgId;
+    SBBufD.MsgId     = MsgId;
+    SBBufD.SizeClass = CFE_SB_SIZE_CLASS_NONE; /* not from the pool, so keep it off the free lists */
     CFE_SB_TrackingListReset(&SBBufD.Link);
 
     PipeDepth = 2;
@@ -3546,6 +3645,40 @@ void Test_TransmitMsgValidate_NoSubscribers(void)
     CFE_UtAssert_EVENTSENT(CFE_SB_SEND_NO_SUBS_EID);
 }
 
+/*
+** Test validating a message that has a route
+*/
+void Test_TransmitMsgValidate_Routed(void)
+{
+    CFE_SB_PipeId_t   PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t    MsgId  = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t    MsgIdRtn;
+    SB_UT_Test_Tlm_t  TlmPkt;
+    CFE_MSG_Size_t    Size       = sizeof(TlmPkt);
+    CFE_MSG_Size_t    SizeRtn    = 0;
+    CFE_SBR_RouteId_t RouteIdRtn = CFE_SBR_INVALID_ROUTE_ID;
+    uint32            LockCount;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 2, "RoutedTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+
+    LockCount = UT_GetStubCount(UT_KEY(OS_MutSemTake));
+
+    CFE_UtAssert_SUCCESS(
+        CFE_SB_TransmitMsgValidate(CFE_MSG_PTR(TlmPkt.TelemetryHeader), &MsgIdRtn, &SizeRtn, &RouteIdRtn));
+    CFE_UtAssert_MSGID_EQ(MsgIdRtn, MsgId);
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(RouteIdRtn), MsgId));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemTake)), LockCount);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter, 0);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
 /*
 ** Test response to sending a message which has an invalid Msg ID
 */
@@ -3579,6 +3712,8 @@ void Test_ReceiveBuffer_API(void)
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PipeReadError);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PendForever);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidBufferPtr);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffers_InvalidArgs);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffers_Queue);
 }
 
 static void SB_UT_PipeIdModifyHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
@@ -3600,6 +3735,34 @@ static void SB_UT_PipeIdModifyHandler(void *UserObj, UT_EntryKey_t FuncKey, cons
     PipeDscPtr->PipeId = CFE_SB_INVALID_PIPE;
 }
 
+/* Hook that invalidates the pipe while a receive is waiting on it */
+static int32 SB_UT_PipeIdInvalidateHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                        const UT_StubContext_t *Context)
+{
+    CFE_SB_PipeD_t *PipeDscPtr = UserObj;
+
+    PipeDscPtr->PipeId = CFE_SB_INVALID_PIPE;
+
+    return StubRetcode;
+}
+
+/* Handler that reads the queue as the default one does, but invalidates the pipe as it does so */
+static void SB_UT_QueueGetPipeIdInvalidateHandler(void *UserObj, UT_EntryKey_t FuncKey,
+                                                  const UT_StubContext_t *Context)
+{
+    osal_id_t       queue_id    = UT_Hook_GetArgValueByName(Context, "queue_id", osal_id_t);
+    void *          data        = UT_Hook_GetArgValueByName(Context, "data", void *);
+    size_t          size        = UT_Hook_GetArgValueByName(Context, "size", size_t);
+    size_t *        size_copied = UT_Hook_GetArgValueByName(Context, "size_copied", size_t *);
+    CFE_SB_PipeD_t *PipeDscPtr  = UserObj;
+    int32           status;
+
+    *size_copied       = UT_Stub_CopyToLocal((UT_EntryKey_t)OS_ObjectIdToInteger(queue_id), data, size);
+    PipeDscPtr->PipeId = CFE_SB_INVALID_PIPE;
+    status             = (*size_copied == 0) ? OS_QUEUE_EMPTY : OS_SUCCESS;
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
 /* Special handler to hit OS_QueueGet error casses */
 static void SB_UT_QueueGetHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
@@ -3803,6 +3966,129 @@ void Test_ReceiveBuffer_PendForever(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test receiving a batch of messages with invalid arguments
+*/
+void Test_ReceiveBuffers_InvalidArgs(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[4];
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    uint32           Count;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "RcvTestPipe"));
+
+    Count = 1;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(NULL, &Count, 4, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(Count, 0);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, NULL, 4, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 0, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 4, PipeId, -5), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
+
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 4, SB_UT_ALTERNATE_INVALID_PIPEID, CFE_SB_POLL),
+                      CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 5);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+
+    UtAssert_INT32_EQ(CFE_SB_ReleaseBuffers(SB_UT_ALTERNATE_INVALID_PIPEID), CFE_SB_BAD_ARGUMENT);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test receiving a batch of messages from a queue pipe
+*/
+void Test_ReceiveBuffers_Queue(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[4];
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_MsgId_t   MsgId  = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeD_t * PipeDscPtr;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    uint32           Count;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "RcvTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 4, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_UINT32_EQ(Count, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 4, PipeId, 100), CFE_SB_TIME_OUT);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 4, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 1);
+
+    /* Takes what is on the queue without waiting for more */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_STUB_COUNT(OS_QueueGet, 3);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 4, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_UINT32_EQ(Count, 1);
+    UtAssert_STUB_COUNT(OS_QueueGet, 5);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->Batch[0]->Content, SBBufPtrs[0]);
+    UtAssert_UINT32_EQ(PipeDscPtr->BatchCount, 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseBuffers(PipeId));
+    UtAssert_UINT32_EQ(PipeDscPtr->BatchCount, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseBuffers(PipeId));
+
+    /* A bad read after the first ends the batch, and is counted and reported */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 2, OS_ERROR);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 4, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_UINT32_EQ(Count, 1);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->Batch[0]->Content, SBBufPtrs[0]);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 2);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseBuffers(PipeId));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+
+    /* A single receive also releases a batch, and the batch a single receive */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_NOT_NULL(PipeDscPtr->LastBuffer);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 4, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_NULL(PipeDscPtr->LastBuffer);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+
+    /* The pipe is deleted while the receive waits */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), SB_UT_QueueGetPipeIdInvalidateHandler, PipeDscPtr);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 4, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet), NULL, NULL);
+    UtAssert_UINT32_EQ(Count, 0);
+    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+
+    /* restore the PipeID so it can be deleted */
+    PipeDscPtr->PipeId = PipeId;
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
 /*
 ** Test releasing zero copy buffers for all pipes owned by a given app ID
 */
@@ -3842,20 +4128,20 @@ void Test_CleanupApp_API(void)
     CFE_SB_CleanUpApp(CFE_ES_APPID_UNDEFINED);
 
     /* This should have freed no buffers  */
-    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 3);
 
     /* Attempt again with a valid application ID */
     CFE_SB_CleanUpApp(AppID);
 
     /* This should have freed 2 out of the 3 buffers -
      * the ones which were gotten by this app. */
-    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
 
     /* Clean up the second App */
     CFE_SB_CleanUpApp(AppID2);
 
     /* This should have freed the last buffer */
-    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 3);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
 
     CFE_UtAssert_EVENTCOUNT(2);
 
@@ -4146,6 +4432,12 @@ void Test_SB_SpecialCases(void)
     SB_UT_ADD_SUBTEST(Test_SB_TransmitMsgPaths_WriteErr);
     SB_UT_ADD_SUBTEST(Test_SB_TransmitMsgPaths_IgnoreOpt);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_UnsubResubPath);
+#if CFE_PLATFORM_SB_RING_PIPES
+    /* Ring storage is only reserved when the platform enables ring pipes */
+    SB_UT_ADD_SUBTEST(Test_RingPipe_Nominal);
+    SB_UT_ADD_SUBTEST(Test_RingPipe_ErrPaths);
+    SB_UT_ADD_SUBTEST(Test_RingPipe_ReceiveBuffers);
+#endif
     SB_UT_ADD_SUBTEST(Test_MessageString);
 }
 
@@ -4235,6 +4527,7 @@ void Test_CFE_SB_Buffers(void)
 
     CFE_SB_BufferD_t *     bd;
     CFE_SB_DestinationD_t *destptr;
+    uint8                  SizeClass;
 
     CFE_SB_Global.StatTlmMsg.Payload.MemInUse     = 0;
     CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = sizeof(CFE_SB_BufferD_t) * 4;
@@ -4245,39 +4538,57 @@ void Test_CFE_SB_Buffers(void)
     CFE_UtAssert_EVENTCOUNT(0);
 
     /*
-     * If returning to the pool fails SB still isn't going to use the buffer anymore,
-     * so it shouldn't be tracked as "in use" - it is lost.
+     * A returned buffer goes on its free list rather than back to ES,
+     * but it is no longer in use as far as the statistics are concerned
      */
     ExpRtn = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse - 1;
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, -1);
     CFE_SB_ReturnBufferToPool(bd);
     UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, ExpRtn);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MemInUse);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Mem.FreeCount[bd->SizeClass], 1);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+
+    /* The next buffer of the same size class is the one just returned, and is counted again */
+    UtAssert_ADDRESS_EQ(CFE_SB_GetBufferFromPool(0), bd);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Mem.FreeCount[bd->SizeClass], 0);
+    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, ExpRtn + 1);
 
     CFE_UtAssert_EVENTCOUNT(0);
 
-    bd->UseCount = 0;
+    bd->UseCount = 1;
     CFE_SB_DecrBufUseCnt(bd);
     UtAssert_INT32_EQ(bd->UseCount, 0);
     UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MemInUse);
 
+    bd->UseCount = 0;
+    CFE_SB_DecrBufUseCnt(bd);
+    UtAssert_INT32_EQ(bd->UseCount, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Mem.FreeCount[bd->SizeClass], 1);
+
     CFE_UtAssert_EVENTCOUNT(0);
 
     destptr = CFE_SB_GetDestinationBlk();
     UtAssert_NOT_NULL(destptr);
     UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, sizeof(*destptr));
 
-    /*
-     * historical behavior has CFE_SB_PutDestinationBlk() return SUCCESS even if the underlying call fails,
-     * but the MemInUse should remain the same
-     */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, -1);
+    /* Returning a destination block reduces MemInUse and keeps the block for reuse */
     CFE_UtAssert_SUCCESS(CFE_SB_PutDestinationBlk(destptr));
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MemInUse);
+    UtAssert_ADDRESS_EQ(CFE_SB_GetDestinationBlk(), destptr);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 2);
     UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, sizeof(*destptr));
-
-    /* normal case should reduce MemInUse */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, sizeof(*destptr));
     CFE_UtAssert_SUCCESS(CFE_SB_PutDestinationBlk(destptr));
-    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MemInUse);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+
+    /* A block too large for any size class bypasses the free lists */
+    UtAssert_UINT32_EQ(CFE_SB_GetSizeClass(CFE_SB_MemPoolDefSize[0] + 1), CFE_SB_SIZE_CLASS_NONE);
+    UtAssert_UINT32_EQ(CFE_SB_GetSizeClass(CFE_SB_MemPoolDefSize[0]), 0);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_NULL(CFE_SB_GetPoolBlock(CFE_SB_MemPoolDefSize[0] + 1, &SizeClass));
+    UtAssert_UINT32_EQ(SizeClass, CFE_SB_SIZE_CLASS_NONE);
+    CFE_SB_PutPoolBlock(destptr, CFE_SB_SIZE_CLASS_NONE);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
 
     CFE_UtAssert_EVENTCOUNT(0);
 }
@@ -4626,6 +4937,248 @@ void Test_ReceiveBuffer_UnsubResubPath(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test sending to and receiving from a ring pipe
+*/
+void Test_RingPipe_Nominal(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_MsgId_t   MsgId  = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t  PipeIdOut;
+    CFE_SB_PipeD_t * PipeDscPtr;
+    SB_UT_Test_Tlm_t TlmPkt;
+    uint32           PipeDepth = 2;
+    CFE_MSG_Type_t   Type      = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size      = sizeof(TlmPkt);
+    union
+    {
+        CFE_ES_PoolAlign_t Align;
+        uint8              Bytes[4096];
+    } PoolBuf;
+    uint32 i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    /* Distinct pool blocks, so both messages can be on the ring at once */
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), &PoolBuf, sizeof(PoolBuf), false);
+
+    CFE_SB_Global.UseRingPipes = true;
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RingPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 1);
+    UtAssert_STUB_COUNT(OS_QueueCreate, 0);
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UtAssert_NOT_NULL(PipeDscPtr->Ring);
+
+    /* Go around the ring more than once */
+    for (i = 0; i < 3; ++i)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+        CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+        CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+        UtAssert_UINT32_EQ(PipeDscPtr->RingCount, 2);
+        UtAssert_UINT32_EQ(PipeDscPtr->PeakQueueDepth, 2);
+
+        CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER));
+        UtAssert_NOT_NULL(SBBufPtr);
+        CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, 100));
+        UtAssert_NOT_NULL(SBBufPtr);
+        UtAssert_UINT32_EQ(PipeDscPtr->RingCount, 0);
+    }
+
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+    UtAssert_STUB_COUNT(OS_QueueGet, 0);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 6);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 3);
+    UtAssert_STUB_COUNT(OS_CountSemTimedWait, 3);
+
+    /* Nothing left to receive */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 1, OS_SEM_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 1, OS_SEM_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, 100), CFE_SB_TIME_OUT);
+
+    /* The pipe is found by the name of its semaphore */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGetIdByName), 1, OS_ERR_NAME_NOT_FOUND);
+    UT_SetDataBuffer(UT_KEY(OS_CountSemGetIdByName), &PipeDscPtr->SysQueueId, sizeof(PipeDscPtr->SysQueueId),
+                     false);
+    CFE_UtAssert_SUCCESS(CFE_SB_GetPipeIdByName(&PipeIdOut, "RingPipe"));
+    CFE_UtAssert_RESOURCEID_EQ(PipeIdOut, PipeId);
+
+    /* Deleting the pipe releases whatever is still on the ring */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_STUB_COUNT(OS_CountSemDelete, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+}
+
+/*
+** Test ring pipe full, give and read error paths
+*/
+void Test_RingPipe_ErrPaths(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_MsgId_t   MsgId  = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeD_t * PipeDscPtr;
+    SB_UT_Test_Tlm_t TlmPkt;
+    uint32           PipeDepth = 1;
+    CFE_MSG_Type_t   Type      = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size      = sizeof(TlmPkt);
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    /* Semaphore create failure */
+    CFE_SB_Global.UseRingPipes = true;
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RingPipe"), CFE_SB_PIPE_CR_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_CR_PIPE_ERR_EID);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RingPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    /* A failed give leaves the ring empty */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemGive), 1, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_WR_ERR_EID);
+    UtAssert_UINT32_EQ(PipeDscPtr->RingCount, 0);
+
+    /* Fill the pipe, then overflow it */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_FULL_ERR_EID);
+    UtAssert_UINT32_EQ(PipeDscPtr->RingCount, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 2);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER));
+
+    /* A wakeup with nothing on the ring */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+
+    /* Semaphore failure */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+}
+
+/*
+** Test receiving batches of messages from a ring pipe
+*/
+void Test_RingPipe_ReceiveBuffers(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH + 1];
+    CFE_SB_MsgId_t   MsgId  = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeD_t * PipeDscPtr;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_MSG_Type_t   Type = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t   Size = sizeof(TlmPkt);
+    uint32           Count;
+    uint32           i;
+    union
+    {
+        CFE_ES_PoolAlign_t Align;
+        uint8              Bytes[8192];
+    } PoolBuf;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    /* Distinct pool blocks, so several messages can be on the ring at once */
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), &PoolBuf, sizeof(PoolBuf), false);
+
+    CFE_SB_Global.UseRingPipes = true;
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 8, "RingPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    /* As many as the default message limit allows */
+    for (i = 0; i < CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT; ++i)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+        CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    }
+
+    /* One wait, then one count taken per further entry */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 2, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_UINT32_EQ(Count, 2);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_STUB_COUNT(OS_CountSemTimedWait, 1);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->Batch[0]->Content, SBBufPtrs[0]);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->Batch[1]->Content, SBBufPtrs[1]);
+    UtAssert_UINT32_EQ(PipeDscPtr->RingCount, CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT - 2);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT - 2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT);
+
+    /* A further count that cannot be taken leaves its entry on the ring */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 2, OS_SEM_TIMEOUT);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 4, PipeId, 100));
+    UtAssert_UINT32_EQ(Count, 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->RingCount, CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT - 3);
+
+    /* More than a batch holds is asked for */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, CFE_PLATFORM_SB_MAX_RECEIVE_BATCH + 1, PipeId,
+                                               CFE_SB_POLL));
+    UtAssert_UINT32_EQ(Count, CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT - 3);
+    UtAssert_UINT32_EQ(PipeDscPtr->RingCount, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT - 3);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseBuffers(PipeId));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+
+    /* Nothing waiting */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 1, OS_SEM_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 4, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+
+    /* A wakeup with nothing on the ring */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 4, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+    UtAssert_UINT32_EQ(Count, 0);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+
+    /* The pipe is deleted while the receive waits */
+    UT_SetHookFunction(UT_KEY(OS_CountSemTake), SB_UT_PipeIdInvalidateHook, PipeDscPtr);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 4, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+    UT_SetHookFunction(UT_KEY(OS_CountSemTake), NULL, NULL);
+    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
+    PipeDscPtr->PipeId = PipeId;
+
+    /* Deleting the pipe releases a batch still held */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffers(SBBufPtrs, &Count, 4, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 0);
+}
+
 /*
 ** Test the paths through the MessageStringSet and MessageStringGet functions
 */
@@ -1932,6 +1932,40 @@ void Test_TransmitMsg_MsgLimitExceeded(void);
 ******************************************************************************/
 void Test_TransmitMsg_GetPoolBufErr(void);
 
+/*****************************************************************************/
+/**
+** \brief Test that a routed message is sent under a single SB lock
+**
+** \par Description
+**        This function tests that sending to a subscribed pipe takes the SB
+**        lock once, and that the sender's identity is not requested from ES
+**        again on its next send.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsg_SingleLock(void);
+
+/*****************************************************************************/
+/**
+** \brief Test that a large message is copied outside the SB lock
+**
+** \par Description
+**        This function tests that a message larger than
+**        #CFE_SB_LOCKED_COPY_MAX is still delivered intact, and that its
+**        copy is made between two separate holds of the SB lock.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsg_LargeCopyUnlocked(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test getting a pointer to a buffer for zero copy mode with buffer
@@ -2061,6 +2095,22 @@ void Test_BroadcastBufferToRoute(void);
 ******************************************************************************/
 void Test_TransmitMsgValidate_NoSubscribers(void);
 
+/*****************************************************************************/
+/**
+** \brief Test validating a message that has a route
+**
+** \par Description
+**        This function tests that the route of a subscribed message is
+**        resolved without taking the SB lock.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsgValidate_Routed(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test response to sending a message which has an invalid Msg ID
@@ -2222,6 +2272,40 @@ void Test_ReceiveBuffer_PendForever(void);
 ******************************************************************************/
 void Test_ReceiveBuffer_InvalidBufferPtr(void);
 
+/*****************************************************************************/
+/**
+** \brief Test receiving a batch of messages with invalid arguments
+**
+** \par Description
+**        This function tests CFE_SB_ReceiveBuffers and CFE_SB_ReleaseBuffers
+**        with bad pointers, counts, timeouts and pipe IDs.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffers_InvalidArgs(void);
+
+/*****************************************************************************/
+/**
+** \brief Test receiving a batch of messages from a queue pipe
+**
+** \par Description
+**        This function tests the CFE_SB_ReceiveBuffers results on a queue pipe,
+**        that a bad read after the first message is reported without losing
+**        the batch, and that the batch is released by CFE_SB_ReleaseBuffers
+**        or the next receive.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffers_Queue(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test releasing zero copy buffers for all pipes owned by a
@@ -2477,6 +2561,55 @@ void Test_SB_TransmitMsgPaths_IgnoreOpt(void);
 ******************************************************************************/
 void Test_ReceiveBuffer_UnsubResubPath(void);
 
+/*****************************************************************************/
+/**
+** \brief Test sending to and receiving from a ring pipe
+**
+** \par Description
+**        This function tests creating a ring pipe, sending to it, receiving
+**        from it with each timeout type, finding it by name and deleting it
+**        with messages still queued.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_RingPipe_Nominal(void);
+
+/*****************************************************************************/
+/**
+** \brief Test ring pipe error paths
+**
+** \par Description
+**        This function tests the semaphore create, give and take failures,
+**        a full ring and a wakeup with an empty ring.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_RingPipe_ErrPaths(void);
+
+/*****************************************************************************/
+/**
+** \brief Test receiving batches of messages from a ring pipe
+**
+** \par Description
+**        This function tests taking several entries off a ring pipe in one
+**        CFE_SB_ReceiveBuffers call, and its error paths.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_RingPipe_ReceiveBuffers(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test MessageStringSet and MessageStringGet function paths
@@ -76,7 +76,7 @@ uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
 {
     if (CFE_SB_IsValidMsgId(MsgId))
     {
-        CFE_SBR_MSGMAP[CFE_SB_MsgIdToValue(MsgId)] = RouteId;
+        CFE_SBR_MAP_STORE(CFE_SBR_MSGMAP[CFE_SB_MsgIdToValue(MsgId)], RouteId);
     }
 
     /* Direct lookup never collides, always return 0 */
@@ -94,7 +94,7 @@ CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
 
     if (CFE_SB_IsValidMsgId(MsgId))
     {
-        routeid = CFE_SBR_MSGMAP[CFE_SB_MsgIdToValue(MsgId)];
+        routeid.RouteId = CFE_SBR_MAP_LOAD(CFE_SBR_MSGMAP[CFE_SB_MsgIdToValue(MsgId)]);
     }
 
     return routeid;
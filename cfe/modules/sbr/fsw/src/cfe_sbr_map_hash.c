@@ -137,7 +137,7 @@ uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
             collisions++;
         }
 
-        CFE_SBR_MSGMAP[hash] = RouteId;
+        CFE_SBR_MAP_STORE(CFE_SBR_MSGMAP[hash], RouteId);
     }
 
     return collisions;
@@ -155,8 +155,8 @@ CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
 
     if (CFE_SB_IsValidMsgId(MsgId))
     {
-        hash    = CFE_SBR_MsgIdHash(MsgId);
-        routeid = CFE_SBR_MSGMAP[hash];
+        hash            = CFE_SBR_MsgIdHash(MsgId);
+        routeid.RouteId = CFE_SBR_MAP_LOAD(CFE_SBR_MSGMAP[hash]);
 
         /*
          * Increment from original hash to find matching route.
@@ -166,8 +166,8 @@ CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
         while (CFE_SBR_IsValidRouteId(routeid) && !CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid), MsgId))
         {
             /* Increment or loop to start of array */
-            hash    = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
-            routeid = CFE_SBR_MSGMAP[hash];
+            hash            = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+            routeid.RouteId = CFE_SBR_MAP_LOAD(CFE_SBR_MSGMAP[hash]);
         }
     }
 
@@ -31,6 +31,23 @@
  */
 #include "cfe_sbr.h"
 
+/*
+ * Message map entries are written under the SB lock but read without it
+ * (see CFE_SBR_GetRouteId).  An entry only ever changes from invalid to a
+ * route whose contents are already set, so a release store paired with an
+ * acquire load is all a reader needs.  Without the GCC builtins the
+ * accesses are volatile, which orders them for the compiler only: enough
+ * on single core targets.
+ */
+#if defined(__GNUC__)
+#define CFE_SBR_MAP_LOAD(Entry)         __atomic_load_n(&(Entry).RouteId, __ATOMIC_ACQUIRE)
+#define CFE_SBR_MAP_STORE(Entry, Value) __atomic_store_n(&(Entry).RouteId, (Value).RouteId, __ATOMIC_RELEASE)
+#else
+#define CFE_SBR_MAP_LOAD(Entry) (*(volatile CFE_SB_RouteId_Atom_t *)&(Entry).RouteId)
+#define CFE_SBR_MAP_STORE(Entry, Value) \
+    ((void)(*(volatile CFE_SB_RouteId_Atom_t *)&(Entry).RouteId = (Value).RouteId))
+#endif
+
 /******************************************************************************
  * Function prototypes
  */
@@ -98,10 +98,12 @@ CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr)
 
     if (CFE_SB_IsValidMsgId(MsgId) && (CFE_SBR_RDATA.RouteIdxTop < CFE_PLATFORM_SB_MAX_MSG_IDS))
     {
-        routeid    = CFE_SBR_ValueToRouteId(CFE_SBR_RDATA.RouteIdxTop);
-        collisions = CFE_SBR_SetRouteId(MsgId, routeid);
+        routeid = CFE_SBR_ValueToRouteId(CFE_SBR_RDATA.RouteIdxTop);
 
+        /* Fill in the entry before the map publishes it to lock-free lookups */
         CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RDATA.RouteIdxTop].MsgId = MsgId;
+        collisions = CFE_SBR_SetRouteId(MsgId, routeid);
+
         CFE_SBR_RDATA.RouteIdxTop++;
     }
 